@@ -7,6 +7,7 @@
 
 #include<string>
 #include<vector>
+#include "mh_dlb.h"
 
 #ifndef MAXSAT_INST_H
 #define MAXSAT_INST_H
@@ -27,8 +28,28 @@ public:
 	 */
 	std::vector<std::vector<int>> clauses;
 
+	/** For each variable, indexed from 0 on, the clauses in which it occurs,
+	 * used for incremental evaluation. An entry c+1 refers to a positive
+	 * occurrence in clause c, -(c+1) to a negated one. Each variable is listed
+	 * at most once per clause, and not at all for clauses that contain the
+	 * variable in positive and negated form, as they are always fulfilled.
+	 */
+	std::vector<std::vector<int>> occurrences;
+
+	/** For each clause, the number of literals that are always fulfilled,
+	 * i.e., 1 for clauses containing a variable in positive and negated form
+	 * and 0 otherwise. */
+	std::vector<int> alwaysFulfilled;
+
+	/** For each variable, the other variables occurring together with it in
+	 * some clause; flipping a variable may only change the effect of flipping
+	 * these variables. */
+	mh::candidateLists neighbors;
+
 	/** Load an instance from the given file in DMACS CNF form. */
 	void load(const std::string &fname);
+	/** Determine occurrences, alwaysFulfilled, and neighbors from the clauses. */
+	void determineOccurrences();
 	/** Write out instance data to stream. */
 	void write(std::ostream &ostr, int detailed=0) const;
 };
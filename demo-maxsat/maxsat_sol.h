@@ -28,6 +28,11 @@ namespace maxsat {
  */
 class MAXSATSol : public mh::binStringSol {
 	friend class MAXSATShakingMethod;
+protected:
+	/** For each clause, the number of fulfilled literals, maintained
+	 * during a k-flip local search; not copied with the solution. */
+	std::vector<int> nFulfilled;
+	int nUnfulfilled=0;		///< Number of unfulfilled clauses during a k-flip local search.
 public:
 	const MAXSATInst *probinst;	///< A pointer to the problem instance for which this is a solution
 
@@ -51,10 +56,32 @@ public:
 	/** Determine the objective value of the solution. Here we count the number
 	 * of satisfied clauses. */
 	double objective() override;
+	/** Determine the number of satisfied clauses, but stop as soon as so many
+	 * clauses are unsatisfied that the bound cannot be reached anymore. */
+	double boundedObjective(double bound) override;
+	/** Prepare the numbers of fulfilled literals per clause for delta_flip(). */
+	void initDeltaFlip() override;
+	/** Incremental evaluation of flipping variable i in time
+	 * linear in the number of its occurrences. */
+	double delta_flip(int i) override;
+	/** delta_flip() is incremental. */
+	bool incrementalDeltaFlip() const override
+		{ return true; }
+	/** Flip variable i and update the numbers of fulfilled literals. */
+	void flip(int i) override;
+	/** When maximizing, at most the unfulfilled clauses can become fulfilled. */
+	double flipGainBound() override;
+	/** Activates the variables sharing a clause with variable i. */
+	void activateFlipNeighbors(int i, mh::dontLookBits &dlb) override;
 	/** A simple construction heuristic, just calling the base class' initialize
 	 * function, initializing each bit randomly. */
 	void construct(int k, mh::SchedulerMethodContext &context, mh::SchedulerMethodResult &result);
-	/** A best improvement local search in the k-flip neighborhood. */
+	/** A best improvement local search in the k-flip neighborhood.
+	 * If k=1 and #lsdlb is set, a complete first improvement local search
+	 * with don't look bits is performed instead; the don't look bits are
+	 * kept in the context together with the resulting local optimum, so that
+	 * in the next call only the variables changed since then and their
+	 * neighbors are considered. */
 	void localimp(int k, mh::SchedulerMethodContext &context, mh::SchedulerMethodResult &result);
 	/** A random sampling of length solutions in the k-flip neighborhood. */
 	void randlocalimp(int k, mh::SchedulerMethodContext &context, mh::SchedulerMethodResult &result);
@@ -21,6 +21,18 @@ class qapFeature : public mh::feature
 protected:
 	/// The penalty values.
 	std::vector<double> pv;
+	/// The permutation of the last local optimum passed to updatePenaltiesDelta().
+	std::vector<int> lastPerm;
+	/// The costs of the features of the last local optimum.
+	std::vector<double> cost;
+
+	/** Updates the feature costs for a new local optimum.
+		Only the terms depending on positions whose facility has changed
+		since the last local optimum are recomputed.
+
+		\param qapc The new local optimum.
+	*/
+	void updateCosts(const qapSol *qapc);
 	
 public:
 	/** Normal constructor.
@@ -52,6 +64,15 @@ public:
 		\param c The solution whose features are used for the penalty update.
 	*/
 	virtual void updatePenalties(const mh::mh_solution *c);
+
+	/** Update penalty values and return the change of the penalty.
+		The utilities are derived from feature costs, which are maintained
+		incrementally from one local optimum to the next.
+
+		\param c The solution whose features are used for the penalty update.
+		\return The increase of the penalty of c.
+	*/
+	virtual double updatePenaltiesDelta(const mh::mh_solution *c);
 	
 	/** Reset penalties of all features to zero. */
 	virtual void resetPenalties();
@@ -49,6 +49,9 @@ public:
 	/// fd-index vector
 	std::vector<int> fdind;
 
+	/// True if both matrices have no negative entries.
+	bool nonnegative = true;
+
 
 	/** Default Constructor.
 		With this the object is not yet fully useable, init() must be called properly.
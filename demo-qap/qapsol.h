@@ -11,6 +11,7 @@
 #include "mh_interfaces.h"
 #include "mh_gaopsprov.h"
 #include "mh_random.h"
+#include "mh_schedmeth.h"
 #include "qapinstance.h"
 #include "qaptabuattribute.h"
 
@@ -32,7 +33,7 @@ extern mh::double_param graspb;
 
 
 /** A concrete solution class for the quadratic assignment problem. */
-class qapSol : public mh::mh_solution, public mh::gaopsProvider, public mh::featureProvider, public mh::tabuProvider, public mh::gcProvider
+class qapSol : public mh::mh_solution, public mh::gaopsProvider, public mh::featureProvider, public mh::tabuProvider, public mh::gcProvider, public mh::moveEvalProvider
 {
 	friend class qapFeature;
 	
@@ -50,12 +51,25 @@ protected:
 	*/
 	static const qapSol &cast(const mh::mh_solution &ref)
 		{ return (dynamic_cast<const qapSol &>(ref)); }
+
+	/** Change of the objective function when swapping the facilities
+		at locations r and s, without the augmented part. */
+	double swapDelta(int r, int s) const;
+
+	/** Determines the locations r<s swapped by the move with the given index. */
+	void moveIdxToSwap(int idx, int &r, int &s) const;
 public:
 	mh::mh_solution *createUninitialized() const override
 		{ return new qapSol(alg, pgroup); }
 	mh::mh_solution *clone() const override
 		{ return new qapSol(*this); }
 	double objective() override;
+	/** Objective function with early termination.
+		For minimization and nonnegative matrices, the evaluation stops
+		after the first matrix row where the partial sum exceeds the bound.
+		\param bound Objective value the solution is compared to.
+	*/
+	double boundedObjective(double bound) override;
 
 	/** Copy constructor.
 		\param c Object to copy from.
@@ -99,6 +113,12 @@ public:
 		\param count Number of mutations.
 	*/
 	void mutate(int count) override;
+
+	/** Greedy path relinking step: among the swaps that move a facility
+		to its location in the guiding solution, the best one is applied.
+		\param guide The guiding solution.
+	*/
+	bool pathRelinkStep(const mh::mh_solution &guide) override;
 	
 	/** Cycle crossover.
 		\param parA Parent A for crossover.
@@ -147,6 +167,15 @@ public:
 		\param m The move to be applied.
 	*/
 	void applyMove(const mh::nhmove &m) override;
+
+	/** Creates a swapMove. */
+	mh::nhmove *createMove() const override
+		{ return new mh::swapMove; }
+
+	/** Chooses two different random facilities to be swapped.
+		\param m The swapMove to be set.
+	*/
+	void randomMove(mh::nhmove &m) override;
 	
 	/** Replace current solution with a better or even the best neighbor.
 		\param find_best If true, the best solution in the neighborhood is searched,
@@ -154,11 +183,39 @@ public:
 	*/
 	void selectImprovement(bool find_best);
 	
+	/** Number of swap moves, i.e., n(n-1)/2. */
+	int nMoves() override
+		{ return length*(length-1)/2; }
+
+	/** Computes the changes of the objective value for a range of swap moves.
+		Moves are ordered as in selectImprovement(). */
+	void evalMoves(int first, int last, double *delta) override;
+
+	/** Applies the swap move with the given index. */
+	void applyMoveIdx(int idx) override;
+
+	/** Tabu attributes are (facility, location) pairs. */
+	void tabuAttributeDims(int &n1, int &n2) override
+		{ n1 = n2 = length; }
+
+	/** A swap is tabu if both facilities would be moved back to
+		locations they have recently left. */
+	bool isTabuMove(int idx, const mh::tabuMemory &tm) override;
+
+	/** Forbids moving the swapped facilities back to their current locations. */
+	void makeTabu(int idx, mh::tabuMemory &tm, int tenure) override;
+
 	/** Getter method for the associated feature object. */
 	mh::feature* getFeature() override;
 
 	/** Greedy construction heuristic. */
 	void greedyConstruct() override;
+
+	/** Construction method for schedulers, a random permutation. */
+	void construct(int k, mh::SchedulerMethodContext &context, mh::SchedulerMethodResult &result);
+
+	/** Shaking method for schedulers, performing k random swaps. */
+	void shaking(int k, mh::SchedulerMethodContext &context, mh::SchedulerMethodResult &result);
 };
 
 } // namespace qap
@@ -11,7 +11,9 @@
 #ifndef MH_ADVBASE_H
 #define MH_ADVBASE_H
 
+#include <memory>
 #include "mh_base.h"
+#include "mh_evalcache.h"
 #include "mh_param.h"
 #include "mh_popbase.h"
 #include "mh_solution.h"
@@ -80,6 +82,8 @@ extern bool_param ltime;
 	sub-algorithm in an island model. */
 class mh_advbase : public mh_base
 {
+	friend class portfolio;	// runs algorithms iteration by iteration
+
 public:
 	/** The population of the metaheuristic.
 		It is not owned by the metaheuristic and therefore not deleted by it. */
@@ -97,8 +101,13 @@ protected:
 	// other class variables
 	mh_solution *tmpSol = nullptr;	///< a temporary solution in which the result of operations is stored
 
+	/** Evaluation cache attached to the solutions of the population and tmpSol,
+		if parameter #ecsize is set. */
+	std::shared_ptr<evalCache> ecache;
+
 	double bestObj = 0;		///< temporary best objective value
 	double timStart = 0;        ///< CPUtime when run() was called
+	timeLimitChecker ttimeChecker;	///< Amortized check of the #ttime criterion.
 
 	// Mirror mhlib parameter for faster access, especially in case an individual parameter group is used:
 	bool _maxi;		///< Mirrored mhlib parameter #maxi.
@@ -137,6 +146,11 @@ public:
 		fulfilled.
 		Called for a stand-alone algorithm, but never if used as island. */
 	virtual void run();
+	/** Performs iterations until the termination criterion is fulfilled
+		like run(), but without writing log entries. Intended for
+		subalgorithms that are run in several threads in parallel,
+		where the common log cannot be used. */
+	void runWithoutLog();
 
 	/** Performs a single iteration.
 		Is called from run(); is also called if used as island. */
@@ -189,6 +203,9 @@ public:
 protected:
 	/** Exits with error if no population is set. */
 	void checkPopulation();
+	/** Attaches the algorithm's evaluation cache to the given solution. */
+	void attachEvalCache(mh_solution *sol)
+		{ sol->ecache=ecache; }
 	/** Saves the best objective value. */
 	virtual void saveBest();
 	/** Checks to see whether the best objective value has changed
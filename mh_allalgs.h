@@ -27,7 +27,10 @@ namespace mh {
 	- 7: greedy randomized adaptive search procedure,
 	- 8: guided local search.
 	- 9: general variable neighborhood search
-	- 10: variable neighborhood descent */
+	- 10: variable neighborhood descent
+	- 11: parallel tempering
+	- 12: parallel GRASP
+	- 13: portfolio of algorithms */
 extern int_param mhalg;
 
 
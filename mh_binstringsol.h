@@ -5,6 +5,7 @@
 #ifndef MH_BINSTRINGSOL_H
 #define MH_BINSTRINGSOL_H
 
+#include "mh_dlb.h"
 #include "mh_stringsol.h"
 #include "mh_nhmove.h"
 
@@ -23,12 +24,75 @@ public:
 	binStringSol(int l, const std::string &pg="") : stringSol<bool>(l,1,pg) { }
 	/** Writes out the binary string. */
 	void write(std::ostream &ostr,int detailed=0) override;
+	/** Returns the change of the objective value by a bitflipMove.
+		The default implementation flips the bit, evaluates the solution
+		completely, and flips the bit back; derived classes should override
+		it with an incremental evaluation. */
+	double delta_obj(const nhmove &m) override;
 	/** Function to apply a certain move.
 	        This will only work with a bitflipMove. */
 	void applyMove(const nhmove &m) override;
-	/** Performs a best improvement k-flip local search, returning
-	    true if an improved solution has been found. */
-	bool k_flip_localsearch(int k);
+	/** Creates a bitflipMove. */
+	nhmove *createMove() const override
+		{ return new bitflipMove; }
+	/** Chooses a random bit to be flipped; works only with a bitflipMove. */
+	void randomMove(nhmove &m) override;
+	/** Returns the change of the objective value when flipping bit i
+		of the current solution, whose objective value must be valid.
+		The solution is not changed. The default implementation performs
+		a complete evaluation; derived classes should override it together
+		with initDeltaFlip() and flip() for an incremental evaluation. */
+	virtual double delta_flip(int i);
+	/** Flips bit i. The objective value is invalidated; derived classes
+		should also update data for delta_flip() here. */
+	virtual void flip(int i)
+		{ data[i]=!data[i]; invalidate(); }
+	/** Returns true if delta_flip() is computed incrementally, i.e., faster
+		than a complete evaluation. Otherwise k_flip_localsearch() evaluates
+		each subset completely once instead of calling delta_flip() twice.
+		The default returns false; derived classes overriding delta_flip()
+		should return true. */
+	virtual bool incrementalDeltaFlip() const
+		{ return false; }
+	/** Prepares data needed by delta_flip() for the current solution.
+		Called at the beginning of a k-flip local search. */
+	virtual void initDeltaFlip() {}
+	/** Returns an upper bound for the improvement of the objective value
+		achievable by flipping any bits of the current solution, e.g.,
+		0 if the solution is known to be optimal. Called after initDeltaFlip();
+		the default returns infinity. */
+	virtual double flipGainBound();
+	/** Performs a k-flip local search, returning true if an improved
+		solution has been found.
+		The k-subsets of the bits are enumerated in revolving door order,
+		so that successive subsets differ in only two bits, and their objective
+		values are determined incrementally via delta_flip() if
+		incrementalDeltaFlip() returns true, otherwise by a complete
+		evaluation per subset. For k=1, the bits
+		are considered in increasing order. The search stops when the
+		improvement reaches flipGainBound().
+		\param k Number of bits to flip.
+		\param find_best If true, the best improving subset is applied,
+			otherwise the first one.
+		\param stop If given, it is polled regularly, and when it returns true,
+			the best subset found so far is applied, e.g., for honouring
+			SchedulerMethodContext::shouldStop(). */
+	bool k_flip_localsearch(int k, bool find_best=true,
+		const std::function<bool()> &stop=nullptr);
+	/** Activates the bits whose delta_flip() may change when flipping bit i.
+		The default activates all other bits; derived classes knowing the
+		structure of the objective function should override it. */
+	virtual void activateFlipNeighbors(int i, dontLookBits &dlb);
+	/** Performs a first improvement 1-flip local search until a local
+		optimum is reached, only considering bits active in the given don't
+		look bits. Bits are deactivated when considered, and the neighbors
+		of flipped bits are activated by activateFlipNeighbors(). If the size
+		of dlb does not match, it is resized and all bits are activated.
+		Returns true if an improved solution has been found. If the
+		predicate stop is given and returns true, the search ends early,
+		leaving the bits not considered yet active. */
+	bool dlb_flip_localsearch(dontLookBits &dlb,
+		const std::function<bool()> &stop=nullptr);
 };
 
 } // end of namespace mh
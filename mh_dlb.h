@@ -0,0 +1,125 @@
+/*! \file mh_dlb.h
+	\brief Don't look bits and candidate lists for neighborhood searches.
+
+	In many neighborhoods, a move is associated with one element, e.g.,
+	a gene, and whether it is improving only depends on the element's
+	surroundings. After a pass in which an element did not yield an
+	improvement, it need not be considered again until a neighboring
+	element changes. dontLookBits maintains the queue of the elements still
+	to be considered, and candidateLists provide the neighbors or the most
+	promising partners of each element. */
+
+#ifndef MH_DLB_H
+#define MH_DLB_H
+
+#include <functional>
+#include <vector>
+#include "mh_param.h"
+
+namespace mh {
+
+/** \ingroup param
+	Use don't look bits in local improvement methods supporting them,
+	e.g., the 1-flip local search of binary strings. */
+extern bool_param lsdlb;
+
+/** Lists of partners for elements 0,...,n-1.
+	Partners may be, e.g., the elements whose moves are affected by a move of
+	an element, or the k most promising partners for two-element moves such as
+	swaps. The lists are stored contiguously. */
+class candidateLists
+{
+public:
+	/** Range of partners of one element, usable in range-based for loops. */
+	struct range
+	{
+		const int *first;	///< First partner.
+		const int *last;	///< Behind the last partner.
+		const int *begin() const { return first; }
+		const int *end() const { return last; }
+		int size() const { return int(last-first); }
+	};
+
+	/** Creates empty lists for no element. */
+	candidateLists() : start(1,0) {}
+	/** Sets the lists to the given ones. */
+	void assign(const std::vector<std::vector<int> > &lists);
+	/** Determines for each of the n elements i the at most k partners j!=i
+		with smallest cost(i,j) in order of increasing cost. Pairs with
+		infinite cost are not considered. Requires O(n^2 log k) time. */
+	void build(int n, int k, const std::function<double(int i, int j)> &cost);
+	/** Returns the number of elements. */
+	int size() const
+		{ return int(start.size())-1; }
+	/** Returns the partners of element i. */
+	range operator[](int i) const
+		{ return range{partners.data()+start[i], partners.data()+start[i+1]}; }
+
+protected:
+	std::vector<int> start;		///< Start of the list of element i in partners.
+	std::vector<int> partners;	///< Concatenated lists of partners.
+};
+
+/** Don't look bits for elements 0,...,n-1, realized as a queue of active
+	elements. Active elements are returned by next() in the order in which
+	they have been activated, and each is contained at most once. A
+	neighborhood search takes elements from the queue until it is empty and
+	activates the neighbors of each changed element, so that elements whose
+	surroundings did not change since their last unsuccessful consideration
+	are skipped. */
+class dontLookBits
+{
+public:
+	/** Creates don't look bits for n elements, which are all inactive. */
+	explicit dontLookBits(int n=0)
+		{ resize(n); }
+	/** Sets the number of elements to n and deactivates all. */
+	void resize(int n);
+	/** Returns the number of elements. */
+	int size() const
+		{ return int(active.size()); }
+	/** Returns true if no element is active. */
+	bool empty() const
+		{ return count==0; }
+	/** Returns true if element i is active. */
+	bool isActive(int i) const
+		{ return active[i]; }
+	/** Activates element i if it is not yet active. */
+	void activate(int i)
+	{
+		if (!active[i])
+		{
+			active[i]=true;
+			queue[(head+count++)%queue.size()]=i;
+		}
+	}
+	/** Activates all partners of element i in the given candidate lists. */
+	void activate(const candidateLists &cl, int i)
+		{ for (int j : cl[i]) activate(j); }
+	/** Activates all elements in increasing order. */
+	void activateAll();
+	/** Deactivates all elements. */
+	void clear();
+	/** Removes the next active element from the queue and returns it,
+		or returns -1 if no element is active. */
+	int next()
+	{
+		if (count==0)
+			return -1;
+		int i=queue[head];
+		head=(head+1)%queue.size();
+		count--;
+		active[i]=false;
+		return i;
+	}
+
+protected:
+	std::vector<bool> active;	///< Active elements.
+	std::vector<int> queue;		///< Circular buffer of the active elements.
+	int head=0;		///< Position of the first active element in queue.
+	int count=0;	///< Number of active elements.
+};
+
+} // end of namespace mh
+
+#endif // MH_DLB_H
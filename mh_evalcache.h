@@ -0,0 +1,79 @@
+/*! \file mh_evalcache.h
+	\brief A bounded cache for objective values of already evaluated solutions.
+
+	Evolutionary algorithms in particular frequently re-create solutions that
+	have already been evaluated earlier in the run. When the evaluation is the
+	dominating cost, an evalCache attached to the solutions (see
+	mh_solution::ecache) avoids these re-evaluations. */
+
+#ifndef MH_EVALCACHE_H
+#define MH_EVALCACHE_H
+
+#include <iostream>
+#include <list>
+#include <unordered_map>
+#include "mh_c11threads.h"
+#include "mh_param.h"
+#include "mh_solution.h"
+
+namespace mh {
+
+/** \ingroup param
+	Maximum number of solutions stored in the evaluation cache of an algorithm;
+	0 disables the cache.
+	The cache requires that hashvalue() and equals() of the solution class
+	do not depend on the objective value, as is the case for stringSol.
+	It must not be used when the objective value of a solution is not
+	determined by the solution alone, e.g. in the guided local search. */
+extern int_param ecsize;
+
+/** A bounded cache of evaluated solutions with least recently used replacement.
+	Solutions are looked up via their hashvalue(), and hits are verified by
+	equals(). At most a given number of solution copies is stored; when the
+	cache is full, the least recently used entry is recycled for a new one.
+	All accesses are synchronized, so that a cache might be shared among
+	threads, e.g. the workers of a ParScheduler. */
+class evalCache
+{
+protected:
+	/** An entry of the cache: a copy of an evaluated solution and its hash value. */
+	struct entry
+	{
+		unsigned long int hash;
+		mh_solution *sol;
+	};
+
+	int capacity;			///< Maximum number of entries.
+	std::list<entry> entries;	///< The entries in LRU order, most recently used first.
+	/// Index from hash values to entries.
+	std::unordered_multimap<unsigned long int, std::list<entry>::iterator> index;
+	std::mutex mutex;		///< Mutex for synchronizing accesses.
+
+public:
+	unsigned long int nLookups = 0;	///< Number of lookups.
+	unsigned long int nHits = 0;	///< Number of successful lookups.
+
+	/** Constructor for a cache holding at most the given number of solutions. */
+	explicit evalCache(int size);
+	/** Constructor taking the size from parameter #ecsize of the given parameter group. */
+	explicit evalCache(const std::string &pg="") : evalCache(ecsize(pg)) {}
+	/** The destructor deletes all stored solutions. */
+	virtual ~evalCache();
+	/** Looks for a stored solution equal to sol with the given hash value.
+		In case of success, true is returned and o is set to the stored objective value. */
+	bool lookup(unsigned long int hash, mh_solution &sol, double &o);
+	/** Stores a copy of the already evaluated solution sol with the given hash value.
+		If the cache is full, the least recently used entry is replaced. */
+	void insert(unsigned long int hash, mh_solution &sol);
+	/** Removes all entries; statistics are kept. */
+	void clear();
+	/** Returns the ratio of successful lookups. */
+	double hitRate() const
+		{ return nLookups ? double(nHits)/nLookups : 0; }
+	/** Writes the hit statistics. */
+	void printStatistics(std::ostream &ostr);
+};
+
+} // end of namespace mh
+
+#endif // MH_EVALCACHE_H
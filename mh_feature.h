@@ -39,6 +39,13 @@ public:
 	/** Update penalty values.
 	        With respect to a given solution.	*/
 	virtual void updatePenalties(const mh_solution *c) = 0;
+	/** Update penalty values with respect to a given local optimum
+	        and return the resulting change of its penalty.
+		By default, the penalty is computed before and after calling
+		updatePenalties(); derived classes should determine the change
+		while updating. */
+	virtual double updatePenaltiesDelta(const mh_solution *c)
+		{ double p=penalty(c); updatePenalties(c); return penalty(c)-p; }
 	/** Reset penalties of all features to zero. */
 	virtual void resetPenalties() = 0;
 	/** Function to compute a tuned influence of penalties.
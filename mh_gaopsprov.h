@@ -43,6 +43,15 @@ public:
 		the objective value is not invalidated. */
 	virtual void applyMove(const nhmove &m) {
 		mherror("gaopsProvider::applyMove() not implemented"); };
+	/** Creates a new move object of the type expected by randomMove(),
+		delta_obj(), and applyMove(). Used by move based algorithms, which
+		reuse the object for all their moves. The default implementation
+		returns nullptr, indicating that move based algorithms are not supported. */
+	virtual nhmove *createMove() const { return nullptr; }
+	/** Sets the given move, which has been obtained from createMove(),
+		to a uniformly chosen random move in the neighborhood of the current solution. */
+	virtual void randomMove(nhmove &m) {
+		mherror("gaopsProvider::randomMove() not implemented"); }
 	/** Mutate solution with given probability/rate (per solution).
 		If prob is negative, the absolute value is interpreted in
 		such a way that each element is mutated with probability
@@ -71,6 +80,14 @@ public:
 		call invalidate() when the solution changes. */
 	virtual void crossover(const mh_solution &parA, const mh_solution &parB) {
 		mherror("gaopsProvider::crossover() not implemented"); }
+	/** Path relinking step.
+		Performs one step on the path from the current solution towards the
+		given guiding solution, i.e., reduces the distance to it, and returns
+		true; if the solution already equals the guiding solution, false is
+		returned. Must call invalidate() or update the objective value when
+		the solution changes. */
+	virtual bool pathRelinkStep(const mh_solution &guide) {
+		mherror("gaopsProvider::pathRelinkStep() not implemented"); return false; }
 	/** Locally improve the current solution.
 		Optional local improve the current solution.
 		Must call invalidate() when the solution changes. */
@@ -21,7 +21,15 @@ extern int_param glsri;
 /** Guided local search.
 	A localsearch is performed with an augmented objective function,
 	which is updated when a new local optimum is found. The chromosomes
-	in the population must implement the featureProvider interface. */
+	in the population must implement the featureProvider interface.
+	The objective values of the solutions of the subalgorithm are augmented
+	ones, updated by the solution class via delta_aobj() when moves are
+	evaluated. The real objective value of a local optimum is derived from
+	the augmented one by subtracting its penalty term given by
+	feature::penalty(), and the augmented value is adjusted by the change of
+	the penalty returned by feature::updatePenaltiesDelta(), so that guidedLS
+	does not evaluate solutions completely and computes the penalty term
+	only once per local optimum. */
 class guidedLS : public lsbase
 {
 protected:
@@ -17,7 +17,7 @@ namespace mh {
 	 * 1 MSSequentialOnce: choose one after the other, each just once, and then return nullptr
 	 * 2 MSRandomRep: uniform random selection with repetitions
 	 * 3 MSRandomOnce: uniform random selection, but each just once; finally return nullptr
-	 * 4 MSSelfadaptive: random selection with self-adaptive probabilities
+	 * 4 MSSelfadaptive: self-adaptive selection by upper confidence bounds on the gain per CPU second
 	 * 5 MSTimeAdaptive: random selection with time-adaptive probabilities (probabilities indirect proportional to used time)*/
 extern int_param schlisel;
 
@@ -28,7 +28,7 @@ extern int_param schlisel;
 	 * 1 MSSequentialOnce: choose one after the other, each just once, and then return nullptr
 	 * 2 MSRandomRep: uniform random selection with repetitions
 	 * 3 MSRandomOnce: uniform random selection, but each just once; finally return nullptr
-	 * 4 MSSelfadaptive: random selection with self-adaptive probabilities
+	 * 4 MSSelfadaptive: self-adaptive selection by upper confidence bounds on the gain per CPU second
 	 * 5 MSTimeAdaptive: random selection with time-adaptive probabilities (probabilities indirect proportional to used time)*/
 extern int_param schshasel;
 
@@ -80,7 +80,8 @@ protected:
 	/**
 	 * An improved solution has been obtained by a method and is stored in tmpSol.
 	 * This method updates worker->pop[0] holding the worker's so far best solution and,
-	 * if updateSchedulerData is set to true, possibly the Scheduler's global best solution at pop[0].
+	 * if updateSchedulerData is set to true, possibly the Scheduler's global best solution at pop[0]
+	 * by ParScheduler::updateGlobalBest().
 	 */
 	void copyBetter(SchedulerWorker *worker, bool updateSchedulerData);
 
@@ -121,14 +122,32 @@ public:
      */
 	SchedulerMethodAndContext getNextMethod(int idx) override;
 
+	/**
+	 * Returns false when the worker has applied a local improvement or shaking method,
+	 * as then all construction methods have been scheduled and only the worker's own data and
+	 * selectors are accessed, except for updating the global best solution and
+	 * migration, which take care of synchronization themselves.
+	 */
+	bool exclusiveUpdate(const SchedulerWorker *worker) const override;
+
+	/**
+	 * Returns true for local improvement methods, as their results are discarded
+	 * when not being better than the incumbent.
+	 */
+	bool boundedAcceptance(const SchedulerMethod *method) override {
+		return method->idx >= int(constheu->size()) &&
+			method->idx < int(constheu->size() + locimpnh[0]->size());
+	}
+
 	/**
 	 * Updates the tmpSol, worker->pop and, if updateSchedulerData is set to true, the scheduler's
 	 * population according to the result of the last method application.
 	 * Furthermore, the worker's incumbent is updated to the global best one with probability
 	 * #schpmig.
 	 * As the exact history of results is irrelevant to the GVNS, the value of storeResult
-	 * is ignored and no result information is appended to the vector's result list.
-	 * This method is called with mutex locked.
+	 * is ignored.
+	 * This method is called with mutex locked only if exclusiveUpdate() returns true;
+	 * the same holds for the preAccept...Hook methods called from here.
 	 */
 	void updateData(int idx, bool updateSchedulerData, bool storeResult) override;
 
@@ -153,22 +172,6 @@ public:
 	virtual void preAcceptShakingSolHook(mh_solution *sol) {
 	}
 
-	/**
-	 * Updates the the scheduler's population in case the best incumbent solution among all workers
-	 * is better than the best solution stored in the scheduler's population.
-	 * As the exact history of results is irrelevant to the GVNS and no results are ever stored,
-	 * the value of clearResults is ignored and the results vectors are not cleared.
-	 */
-	virtual void updateDataFromResultsVectors(bool clearResults);
-
-
-	/** Procedure that is called from updateDataFromResultsVectors before a solution obtained from a shaking method
-	 * is actually accepted as new incumbent. The default implementation does nothing. Can be used
-	 * for postprocessing or cleaning up the solution.
-	 */
-	virtual void preAcceptFromResultsVectorsHook(mh_solution *sol) {
-	}
-
 	/**
 	 * Updates the statistics data after applying a method in worker.
 	 * The special aspect here is that method times and success rates of shaking neighborhoods
@@ -177,7 +180,7 @@ public:
 	 * @param worker current worker object
 	 * @param methodTime CPU time used by the method call
 	 */
-	void updateMethodStatistics(SchedulerWorker *worker, double methodTime);
+	void updateMethodStatistics(SchedulerWorker *worker, double methodTime) override;
 
 	/**
 	 * Separate statistics update for shaking methods, which is called after performing
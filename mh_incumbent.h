@@ -0,0 +1,82 @@
+/*! \file mh_incumbent.h
+	\brief Publication of a best solution shared by multiple threads.
+
+	A sharedIncumbent holds an immutable copy of the so far best solution
+	together with its objective value. Threads can compare their solutions
+	with the shared one by a single atomic load and read the solution
+	without locking; replaced copies are only deleted when no thread reads
+	them anymore, which is ensured by hazard pointers. */
+
+#ifndef MH_INCUMBENT_H
+#define MH_INCUMBENT_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "mh_solution.h"
+
+namespace mh {
+
+/** A best solution published to multiple threads.
+	Each reading thread uses its own reader index in 0,...,nreaders-1.
+	Reading is lock-free, while publishing a new solution, which is
+	assumed to be rare, is serialized by a mutex. */
+class sharedIncumbent
+{
+public:
+	/** Creates an empty incumbent for the given number of readers. */
+	explicit sharedIncumbent(int nreaders=1);
+	/** The destructor deletes all copies. */
+	~sharedIncumbent();
+	/** Removes the solution and sets the number of readers.
+		Must not be called concurrently with other methods. */
+	void reset(int nreaders);
+	/** Returns true if no solution has been published yet. */
+	bool empty() const
+		{ return current.load()==nullptr; }
+	/** Returns the objective value of the published solution; only
+		meaningful if a solution has been published. */
+	double obj() const
+		{ return curObj.load(); }
+	/** Returns the number of published solutions, which may be used
+		to recognize a change. */
+	unsigned long int version() const
+		{ return nPublished.load(); }
+	/** Publishes a copy of the given solution if no solution has been
+		published yet or if it is better than the published one.
+		Returns true in this case. */
+	bool publish(mh_solution &sol);
+	/** Calls f for the published solution, which is guaranteed not
+		to be deleted meanwhile and must not be modified. Returns false
+		without calling f if no solution has been published. */
+	bool read(int reader, const std::function<void(mh_solution *)> &f);
+
+protected:
+	/** An immutable copy of a published solution. */
+	struct snapshot
+	{
+		mh_solution *sol;	///< The solution.
+		double obj;			///< Its objective value.
+	};
+
+	std::atomic<snapshot *> current;	///< Currently published snapshot.
+	std::atomic<double> curObj;			///< Objective value of the current snapshot.
+	std::atomic<unsigned long int> nPublished;	///< Number of published snapshots.
+	/** Hazard pointers: the snapshot currently read by each reader or nullptr. */
+	std::unique_ptr<std::atomic<snapshot *>[]> hazards;
+	int nReaders;					///< Number of readers.
+	std::vector<snapshot *> retired;	///< Replaced snapshots not deleted yet.
+	std::mutex writeMutex;			///< Serializes publishing.
+
+	/** Deletes the retired snapshots not read by any reader; writeMutex must be held. */
+	void reclaim();
+	/** Deletes a snapshot. */
+	static void destroy(snapshot *s)
+		{ delete s->sol; delete s; }
+};
+
+} // end of namespace mh
+
+#endif // MH_INCUMBENT_H
@@ -38,6 +38,46 @@ public:
 	virtual ~tabuProvider() {};
 };
 
+/** An abstract interface class for solutions providing an indexed
+    neighborhood with delta evaluation.
+    The moves of the neighborhood of the current solution are numbered
+    0,...,nMoves()-1. Algorithms such as tabuSearch use this interface to
+    evaluate whole neighborhoods in batches, select moves themselves, and
+    maintain a value-typed tabuMemory; the solution class only supplies
+    the delta evaluation, the application of moves, and the mapping of
+    moves to tabu attributes. */
+class moveEvalProvider
+{
+public:
+	/// Virtual destructor.
+	virtual ~moveEvalProvider() {};
+
+	/** Returns the number of moves in the neighborhood of the current solution. */
+	virtual int nMoves() = 0;
+
+	/** Computes the changes of the objective value for the moves first,...,last-1
+	    and stores them in delta[0],...,delta[last-first-1].
+	    The solution must not be modified, so that concurrent calls for
+	    disjoint ranges are possible. */
+	virtual void evalMoves(int first, int last, double *delta) = 0;
+
+	/** Applies the move with the given index to the solution.
+	    The objective value need not be updated, this is done by the caller. */
+	virtual void applyMoveIdx(int idx) = 0;
+
+	/** Determines the dimensions of the tabuMemory needed for the
+	    attributes of the moves. */
+	virtual void tabuAttributeDims(int &n1, int &n2) = 0;
+
+	/** Checks whether the move with the given index is tabu with respect to
+	    the given tabuMemory. */
+	virtual bool isTabuMove(int idx, const tabuMemory &tm) = 0;
+
+	/** Makes the attributes of the move with the given index tabu for
+	    the given tenure. Called before the move is applied. */
+	virtual void makeTabu(int idx, tabuMemory &tm, int tenure) = 0;
+};
+
 /** An abstract interface class for algorithms which provide an augmented
     objective method. */
 class aObjProvider
@@ -6,6 +6,7 @@
 
 #include "mh_interfaces.h"
 #include "mh_lsbase.h"
+#include "mh_nhscan.h"
 #include "mh_param.h"
 
 namespace mh {
@@ -14,19 +15,29 @@ namespace mh {
 /** Simple local search.
 	During each iteration, a move in the neighborhood is performed
 	and the current solution is replaced if the new solution is not
-	worse. */
+	worse.
+	If a next or best improvement step function is selected by #mvnbop and
+	the solution class is a moveEvalProvider, the neighborhood is scanned by
+	an nhScanner, i.e., possibly in parallel with #nhthreads threads, and
+	the objective value is updated incrementally. */
 class localSearch : public lsbase, public glsSubAlgorithm
 {
+protected:
+	/** Scanner for improvement steps with moveEvalProviders, or nullptr. */
+	nhScanner *scanner = nullptr;
+
 public:
 	/** The constructor.
 		An initialized population already containing solutions
 		must be given. Note that the population is NOT owned by the 
 		algorithm and will not be deleted by its destructor. 
 		localSearch always only uses the first solution. */
-	localSearch(pop_base &p, const std::string &pg="") : lsbase(p,pg) {};
+	localSearch(pop_base &p, const std::string &pg="");
 	/** Another constructor.
 		Creates an empty EA that can only be used as a template. */
 	localSearch(const std::string &pg="") : lsbase(pg) {};
+	/** The destructor. */
+	~localSearch() { delete scanner; }
 	/** Create new localSearch.
 		Returns a pointer to a new localSearch. */
 	mh_advbase *clone(pop_base &p, const std::string &pg="")
@@ -0,0 +1,158 @@
+/*! \file mh_nhscan.h
+	\brief Parallel scanning of neighborhoods with delta evaluation.
+
+	For large neighborhoods, such as the O(n^2) swap moves of permutation
+	problems, a single best or first improvement step dominates the running
+	time of local search and tabu search. An nhScanner partitions the moves
+	of a moveEvalProvider into batches that are evaluated by idle threads of
+	the shared threadPool, and reduces the results to the best or first move. */
+
+#ifndef MH_NHSCAN_H
+#define MH_NHSCAN_H
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <vector>
+#include "mh_interfaces.h"
+#include "mh_param.h"
+#include "mh_schedmeth.h"
+#include "mh_solution.h"
+#include "mh_threadpool.h"
+
+namespace mh {
+
+/** \ingroup param
+	Number of threads used for scanning a neighborhood, including the
+	calling thread; 1 means a sequential scan. */
+extern int_param nhthreads;
+
+/** \ingroup param
+	Number of moves evaluated at once by a single call of
+	moveEvalProvider::evalMoves() when scanning a neighborhood. */
+extern int_param nhbatch;
+
+/** Scanner for neighborhoods given by a moveEvalProvider.
+	The moves 0,...,nMoves()-1 are split into batches, which are
+	dynamically distributed among the calling thread and up to threads()-1
+	idle threads of threadPool::global(), so that no threads are created
+	per scan and nested parallelism does not oversubscribe. The result does not depend on the number
+	of threads: In best improvement mode, the best move with the smallest
+	index is returned; in first improvement mode, the improving move with the
+	smallest index is returned, and batches beyond an already found move are
+	cancelled. A scanner may only be used by one thread at a time.
+	Helper threads are taken from threadPool::global() unless another
+	pool is set by setPool(). */
+class nhScanner
+{
+public:
+	/** Type of an optional predicate deciding whether a move with given
+		index and change of the objective value is admissible. It must be
+		thread-safe, e.g., only read the solution. */
+	typedef std::function<bool(int idx, double delta)> admissibleFunc;
+
+	/** Constructor for the given number of threads and batch size. */
+	nhScanner(int threads, int batch);
+	/** Constructor taking the number of threads and the batch size from the
+		parameters #nhthreads and #nhbatch of the given parameter group. */
+	explicit nhScanner(const std::string &pg="") :
+		nhScanner(nhthreads(pg), nhbatch(pg)) {}
+	/** Destructor. */
+	virtual ~nhScanner() {}
+	/** Returns the number of threads used. */
+	int threads() const { return nThreads; }
+	/** Sets the thread pool from which helper threads are taken. */
+	void setPool(threadPool &p) { pool = &p; }
+
+	/** Scans the neighborhood of the given moveEvalProvider.
+		Only admissible moves with a change of the objective value
+		strictly better than limit are considered. If find_best is set,
+		the best such move is selected, otherwise the first one.
+		The index of the selected move is returned and delta is set to its
+		change of the objective value; if there is no such move, -1 is returned.
+		\param mep The solution whose neighborhood is scanned.
+		\param maxi True in case of maximization.
+		\param find_best Best or first improvement.
+		\param limit Only moves with better deltas are considered.
+		\param delta Change of the objective value of the selected move.
+		\param admissible Optional predicate for filtering moves. */
+	int scan(moveEvalProvider &mep, bool maxi, bool find_best, double limit,
+		double &delta, const admissibleFunc &admissible=nullptr);
+
+	/** Performs a best or first improvement step on the given solution,
+		which must be a moveEvalProvider. The objective value is updated
+		incrementally. Returns true if an improving move has been applied. */
+	bool improve(mh_solution &sol, bool find_best);
+
+protected:
+	/** Result of the scan of a single thread. */
+	struct result
+	{
+		int idx;		///< Index of selected move or -1.
+		double delta;	///< Change of the objective value of the move.
+	};
+
+	int nThreads;		///< Number of threads including the calling one.
+	int batchSize;		///< Number of moves evaluated at once.
+	threadPool *pool;	///< Pool providing the helper threads.
+	std::vector<std::vector<double> > buffers;	///< Per-thread buffers for deltas.
+	std::vector<result> results;	///< Per-thread results.
+	std::vector<std::exception_ptr> exceptions;	///< Per-thread exceptions.
+
+	// data of the current scan
+	moveEvalProvider *mep = nullptr;	///< The scanned solution.
+	int nMoves = 0;			///< Number of moves.
+	bool maxi = false;		///< Maximization.
+	bool findBest = true;	///< Best or first improvement.
+	double limit = 0;		///< Only moves with better deltas are considered.
+	const admissibleFunc *admissible = nullptr;	///< Optional filter.
+	std::atomic<int> nextBatch;	///< Next batch to be evaluated.
+	std::atomic<int> firstFound;	///< Smallest index of a found move in first improvement mode.
+	std::atomic<bool> cancelled;	///< Set when an exception occurred in some thread.
+
+	/** Returns true if delta d1 is better than d2. */
+	bool better(double d1, double d2) const
+		{ return maxi ? d1 > d2 : d1 < d2; }
+	/** Evaluates batches of the current scan as thread t. */
+	void work(int t);
+};
+
+/** Local improvement method for schedulers, e.g., as VND method of GVNS,
+	for solutions that are moveEvalProviders. Best or first improvement
+	steps are performed by an nhScanner with #nhthreads threads and
+	batches of #nhbatch moves of the given parameter group, taking helper
+	threads from the pool of the method's context, until a local optimum is
+	reached or the method should stop. Improved solutions are passed to
+	the scheduler by SchedulerMethodContext::reportImprovement() after
+	each step, so that they may be published before the method returns.
+	Each context keeps its own scanner in SchedulerMethodContext::userData,
+	so that the method may be run concurrently by the workers of a
+	ParScheduler. */
+class nhScanSchedulerMethod : public SchedulerMethod
+{
+public:
+	/** Constructor for the given name, the improvement strategy, and
+		the parameter group of #nhthreads and #nhbatch. */
+	nhScanSchedulerMethod(const std::string &_name, bool find_best=true,
+			const std::string &pg="", bool adaptive=true) :
+		SchedulerMethod(_name, 1, adaptive), findBest(find_best), pgroup(pg) {}
+	/** Performs improvement steps on sol until a local optimum is reached. */
+	void run(mh_solution *sol, SchedulerMethodContext &context,
+		SchedulerMethodResult &result) const override;
+
+protected:
+	const bool findBest;		///< Best or first improvement.
+	const std::string pgroup;	///< Parameter group of #nhthreads and #nhbatch.
+
+	/** The scanner of a context. */
+	class ScannerData : public SchedulerMethodContext::UserData
+	{
+	public:
+		explicit ScannerData(const std::string &pg) : scanner(pg) {}
+		nhScanner scanner;	///< The scanner.
+	};
+};
+
+} // end of namespace mh
+
+#endif // MH_NHSCAN_H
@@ -308,6 +308,9 @@ public:
 		else
 			return it->second; 
 	}
+	/// Returns true if a value has been set specifically for the given parameter group.
+	bool isSetFor(const std::string &pgroup) const
+		{ return qvals.find(pgroup) != qvals.end(); }
 	/// Set a new value and default value for a parameter.
 	void setDefault(const T &newval)
 		{ defval=value=newval; validate(); }
@@ -0,0 +1,114 @@
+/*! \file mh_pargrasp.h
+  \brief Parallel greedy adaptive randomized search procedure with
+  an elite pool and optional path relinking. */
+
+#ifndef MH_PARGRASP_H
+#define MH_PARGRASP_H
+
+#include <exception>
+#include <vector>
+#include "mh_lsbase.h"
+#include "mh_param.h"
+#include "mh_random.h"
+
+namespace mh {
+
+/** \ingroup param
+    Number of GRASP iterations performed in parallel by the parallel
+    GRASP, each with own data, using idle threads of the shared
+    threadPool. */
+extern int_param pgthreads;
+
+/** \ingroup param
+    Maximum number of solutions in the elite pool of the parallel GRASP;
+    0 disables the pool and therefore also path relinking. */
+extern int_param pgelite;
+
+/** \ingroup param
+    Probability for performing path relinking from the local optimum of
+    a GRASP iteration towards a random solution of the elite pool. */
+extern double_param pgpr;
+
+/** Parallel greedy adaptive randomized search procedure.
+	In each iteration, #pgthreads GRASP iterations, i.e., a randomized
+	greedy construction followed by the subalgorithm as in GRASP, are
+	performed in parallel by the calling thread and idle threads of
+	threadPool::global(). Each worker has its own subpopulation
+	and its own random number generator, so that results only depend on
+	the seed. Subalgorithms are run without logging. The subalgorithm is
+	configured by the parameter group "sub"; if its #mhalg is not set
+	there and the inherited value would be a parallel GRASP or a
+	portfolio, a local search is used. Explicitly nesting these
+	algorithms is an error.
+	The best local optima are kept in an elite pool of at most #pgelite
+	different solutions. With probability #pgpr, path relinking from the
+	local optimum towards a random elite solution is performed via
+	gaopsProvider::pathRelinkStep(); if the best solution on the path is
+	better than the local optimum, the subalgorithm is also applied to it.
+	The elite pool and the population are only updated after all threads
+	of an iteration have finished, in the order of the threads, thus
+	the threads read the elite pool without any synchronization.
+	Each GRASP iteration counts as an iteration for the termination
+	criteria, and the number of threads used in the last iteration is
+	reduced if #titer would be exceeded. As the CPU times of all threads
+	sum up, time limits (#ttime) should usually be given in wall clock
+	time (#wctime).
+	The solutions must implement the gcProvider interface. */
+class parallelGRASP : public lsbase
+{
+protected:
+	/** The data of a single thread. */
+	struct worker
+	{
+		pop_base *spop = nullptr;	///< Subpopulation for the subalgorithm.
+		mh_solution *prCur = nullptr;	///< Current solution in path relinking.
+		mh_solution *prBest = nullptr;	///< Best solution on the path.
+		mh_randomNumberGenerator rng;	///< The thread's random number generator.
+		int nSubIterations = 0;		///< Iterations of subalgorithms not yet added.
+		int nRelinkings = 0;		///< Path relinkings not yet added.
+		int nRelinkSuccesses = 0;	///< Successful path relinkings not yet added.
+		std::exception_ptr exception;	///< Exception possibly occurred in the thread.
+	};
+
+	std::vector<worker *> workers;		///< The workers.
+	std::vector<mh_solution *> elite;	///< The elite pool.
+
+	int _pgelite;		///< Mirrored mhlib parameter #pgelite.
+	double _pgpr;		///< Mirrored mhlib parameter #pgpr.
+
+	int nRelinkings = 0;	///< Number of performed path relinkings.
+	int nRelinkSuccesses = 0;	///< Number of path relinkings yielding a better solution.
+
+	/** Performs a GRASP iteration in the worker's thread. */
+	virtual void graspIteration(worker *w);
+	/** Runs the subalgorithm on the worker's subpopulation. */
+	virtual void runSubAlgorithm(worker *w);
+	/** Performs path relinking from the worker's local optimum to the given guide.
+		Returns true if a better solution has been found on the path. */
+	virtual bool pathRelinking(worker *w, mh_solution &guide);
+	/** Considers the given solution for inclusion in the elite pool. */
+	virtual void updateElite(mh_solution *sol);
+
+public:
+	/** The constructor.
+		An initialized population already containing solutions
+		must be given. Note that the population is NOT owned by the
+		algorithm and will not be deleted by its destructor. */
+	parallelGRASP(pop_base &p, const std::string &pg="");
+	/** Another constructor.
+		Creates an empty algorithm that can only be used as a template. */
+	parallelGRASP(const std::string &pg="") : lsbase(pg), _pgelite(0), _pgpr(0) {}
+	/** The destructor. */
+	virtual ~parallelGRASP();
+	/** Create new parallelGRASP object. */
+	mh_advbase *clone(pop_base &p, const std::string &pg="")
+		{ return new parallelGRASP(p,pg); }
+	/** Performs GRASP iterations in all threads in parallel. */
+	void performIteration() override;
+	/** Prints the usual statistics and the path relinking statistics. */
+	void printStatistics(std::ostream &ostr) override;
+};
+
+} // end of namespace mh
+
+#endif //MH_PARGRASP_H
@@ -6,7 +6,10 @@
 #ifndef MH_PARSCHEDULER_H
 #define MH_PARSCHEDULER_H
 
+#include <atomic>
+#include <deque>
 #include "mh_c11threads.h"
+#include "mh_incumbent.h"
 #include "mh_scheduler.h"
 
 namespace mh {
@@ -16,23 +19,92 @@ namespace mh {
  * If set to a larger value than one, multithreading is thus applied. Note that in this case
  * some more iterations might be performed than specified by #titer and #tciter, as all
  * threads are kept as busy as possible until a termination condition is fulfilled, and
- * then all active methods are completed. Especially in combination with #schsync turned on,
- * the log output might also be misleading since results of the individual methods are applied in
- * a delayed way in order to achieve a deterministic outcome.
+ * then all active methods are completed. In combination with #schsync turned on,
+ * the log entries are written when results are committed, i.e., possibly delayed.
  */
 extern int_param schthreads;
 
 /** \ingroup param
- * If set to true, the synchronization of the threads in the scheduler is active (default: false).
- * In particular, the optimization will consist of two repeating phases:
- * The actual working phase, where the threads run the currently scheduled methods in parallel,
- * and the synchronization phase, where threads wait until every thread is finished before starting
- * the next working phase.
- * Only if all threads are in the synchronization phase,the scheduler's data is updated.
- * No (global) updates happen during the working phase.
+ * If set to true, the threads of the scheduler are synchronized in order to obtain a
+ * deterministic outcome for a given seed (default: false).
+ * Each method application gets a logical timestamp, its ticket, which is
+ * round*#schthreads+id for the round-th method application of the worker with the given id.
+ * Workers run their methods asynchronously, but their results are committed to the
+ * scheduler's data, i.e., the global best solution, the iteration counter, the termination
+ * criteria and the log, strictly in the order of the tickets. Scheduling and updating data
+ * that need exclusive access, see ParScheduler::exclusiveUpdate(), are performed
+ * when all results with smaller tickets have been committed. Migration uses the global best
+ * solution as committed at the beginning of the round #schlag rounds before.
+ * Results are only reproducible if the methods and the method selection do not depend on
+ * measured times, e.g., by #ttime or time-based adaptive selection strategies.
  */
 extern bool_param schsync;
 
+/** \ingroup param
+ * Number of rounds a worker may run ahead of the committed results if #schsync is set.
+ * Larger values reduce waiting for slower workers, but migrated solutions are older.
+ */
+extern int_param schlag;
+
+/** \ingroup param
+ * Pinning of the scheduler's worker threads to logical CPUs: 0: no pinning,
+ * 1: compact, i.e., workers fill up the hardware threads of a core and the cores of a
+ * processor package before the next one is used, 2: scatter, i.e., consecutive
+ * workers are distributed over the packages and cores, see cpuPlacementOrder().
+ * Only supported under Linux, ignored otherwise. Each worker allocates its data in its
+ * own thread after being pinned, so that it is local to the worker's NUMA node.
+ */
+extern int_param schpin;
+
+/** \ingroup param
+ * If set, the number of active worker threads of the scheduler is adapted at runtime
+ * between one and #schthreads, starting with all. Every #schelint seconds (wall clock),
+ * the active workers' fractions of time spent waiting for an available method and for
+ * the scheduler's mutex and the share of the CPU they obtain while running methods, which
+ * is low if there are more workers than free cores, are measured: if a worker is
+ * rather idle, contended, or starved, a worker is parked; otherwise another one is activated, which is reverted if the rate of improvements (or of
+ * iterations, if there are too few improvements) did not grow by at least half of the
+ * ideal linear speedup. Parked workers wait on a condition variable and keep their data.
+ * The chosen numbers of threads over time are reported by printStatistics().
+ * Ignored if #schsync is set.
+ */
+extern bool_param schelastic;
+
+/** \ingroup param
+ * Interval in seconds (wall clock) between adaptations of the number of active worker
+ * threads if #schelastic is set.
+ */
+extern double_param schelint;
+
+/** \ingroup param
+ * Number of method applications a worker performs as a batch without locking the scheduler's
+ * mutex, if they do not need exclusive access, see ParScheduler::exclusiveUpdate(); 0 means
+ * that the batch size is adapted such that a batch takes about #schbatcht seconds. The clock
+ * is only read once per batch and the CPU time of the batch, including scheduling and updating
+ * the data, is attributed evenly to the applications for the method statistics, which are
+ * collected locally. The iterations are counted, the termination criteria checked and the log
+ * written once per batch; a batch ends early when the iterations counted so far together with
+ * those of the running batches reach #titer or the limit given by #tciter, thus these limits are
+ * only exceeded by applications that are running concurrently. Other termination criteria may be
+ * recognized up to a batch later, and log entries of intermediate iterations are omitted.
+ * Intended for very short methods. Ignored if #schsync is set.
+ */
+extern int_param schbatch;
+
+/** \ingroup param
+ * Intended CPU time in seconds of a batch of method applications if #schbatch is 0.
+ */
+extern double_param schbatcht;
+
+/** \ingroup param
+ * If set, the methods running in other workers are requested to stop via their
+ * CancellationToken when a new global best solution is published and the incumbent
+ * solution of the worker at the start of the method is worse, as the worker's search has then
+ * been overtaken, see SchedulerMethodContext::shouldStop(). The result of a cancelled method
+ * is processed as usual. Ignored if #schsync is set, as the outcome would depend on the timing.
+ */
+extern bool_param schcancel;
+
 /** \ingroup param
  * Migration probability for a thread in the scheduler to update its incumbent solution after a major
  * iteration by copying the global best solution.
@@ -44,12 +116,12 @@ extern double_param schpmig;
 //--------------------------- SchedulerWorker ------------------------------
 
 /**
- * SchedulerWorker that runs as own thread spawned by the scheduler.
+ * SchedulerWorker that runs as concurrent task of the shared threadPool, or in the thread calling
+ * ParScheduler::run() for the first worker.
  * The class contains in particular pointers to the Scheduler, SchedulerMethod and
  * the workers own population to which the method is to be applied.
- * Furthermore, the class maintains a vector for storing SchedulerMethodResult entries.
- * Currently, this vector is only used in the context of thread synchronization to keep track
- * of all results until the update of the global data structures is performed for all threads.
+ * If #schsync is set, the results of method applications are queued in the worker until
+ * they are committed in the order of their tickets.
  */
 class SchedulerWorker {
 public:
@@ -57,13 +129,38 @@ public:
 	int id;							///< Index of the worker in the scheduler's worker vector.
 	SchedulerMethod* method;		///< Pointer to the method currently scheduled for this worker.
 	SchedulerMethodContext* methodContext;		///< Pointer to the SchedulerMethodContext object associated to the method currently scheduled for this worker.
-	std::thread thread;				///< Thread doing the work performing the method.
 	std::array<double,maxStackedMethods> startTime;	///< Time when the last method call has been started.
 	mh_randomNumberGenerator* rng;  ///< The random number generator used in this thread.
-
-	bool isWorking;				///< Indicates if the thread is currently in the working phase, i.e. a method has been assigned to it (only meaningful, if #schsync is set to true).
-	bool terminate;				///< Indicates if this thread specifically is to be terminated.
-	std::vector<SchedulerMethodResult> results;	///< List for storing the results achieved with this worker. Currently only used in the context of thread synchronization.
+	CancellationToken cancelToken;	///< Token for requesting the method running in this worker to stop.
+	std::atomic<bool> methodRunning;	///< Indicates that a method is running in this worker.
+	std::atomic<double> methodStartObj;	///< Objective value of the worker's incumbent when the running method was started.
+
+	bool exclusive;				///< Indicates if the scheduler's mutex is held during the current scheduling or data update, see ParScheduler::exclusiveUpdate().
+	unsigned long int ticket;	///< Logical timestamp of the current method application (only meaningful if #schsync is set).
+
+	/** Data on the application of a method as passed to addMethodStatistics(). */
+	struct MethodStatistics {
+		int methodIdx;		///< Index of the method.
+		int iter;			///< Number of iterations.
+		double time;		///< Time.
+		double netTime;		///< Netto time.
+		int success;		///< Number of successful iterations.
+		double gain;		///< Gain in the objective value.
+	};
+	/** Result of a method application waiting to be committed if #schsync is set. */
+	struct PendingResult {
+		unsigned long int ticket;	///< Ticket of the method application.
+		SchedulerMethod *method;	///< Applied method or nullptr if no method could be scheduled.
+		mh_solution *sol;			///< Solution offered as new global best solution or nullptr.
+		std::vector<MethodStatistics> stats;	///< Method statistics, only added when the result is committed.
+	};
+	/** Method statistics of the current method application if #schsync is set,
+	 * which are queued with its result. */
+	std::vector<MethodStatistics> uncommittedStats;
+	std::deque<PendingResult> pending;	///< Results not committed yet, protected by the scheduler's mutex.
+	mh_solution *offered;		///< Solution offered as new global best solution by the current method application.
+	bool hasOffered;			///< Indicates if a solution has already been offered by the worker.
+	double offeredObj;			///< Objective value of the best solution offered by the worker so far.
 
 	/**
 	 * Population of solutions associated with this worker.
@@ -79,47 +176,104 @@ public:
 	/** Indicates the outcome of the last method application w.r.t. tmpSol. */
 	SchedulerMethodResult tmpSolResult;
 
+	/* Statistical data on methods collected by this worker and not yet merged
+	 * into the scheduler's statistics by ParScheduler::mergeMethodStatistics(). */
+	std::vector<int> nIter;			///< Number of iterations of the particular methods.
+	std::vector<double> totTime;	///< Total time spent running the particular methods.
+	std::vector<double> totNetTime;	///< Total netto time spent for the methods.
+	std::vector<int> nSuccess;		///< Number of successful iterations of the particular methods.
+	std::vector<double> sumGain;	///< Total gain achieved by the particular methods.
+	std::mutex statsMutex;			///< Mutex for the worker's statistical data.
+	std::atomic<bool> statsPending;	///< Indicates if there are statistical data not merged yet.
+
+	/* Data of the current batch of method applications, see #schbatch. */
+	bool batching;					///< Indicates that statistical data are collected for a batch.
+	std::vector<int> batchIter;		///< Number of iterations of the particular methods in the batch.
+	std::vector<int> batchSuccess;	///< Number of successful iterations in the batch.
+	std::vector<double> batchGain;	///< Gain achieved in the batch.
+	int batchSize;					///< Current batch size if it is adapted.
+	int batchImprovements;			///< Number of applications yielding a better solution in the batch.
+	bool scheduled;					///< Indicates that runBatch() has scheduled a method needing exclusive access, which has not been applied yet.
+	double avgMethodTime;			///< Exponential moving average of the CPU time per method application.
+
 	/**
 	 * Constructs a new worker object for the given scheduler, method and solution, which
 	 * will be executable by the run() method.
 	 * The thread running this worker will use the value of threadSeed as random seed for
 	 * the random number generator.
 	 */
-	SchedulerWorker(class ParScheduler* _scheduler, int _id, const mh_solution *sol, mh_randomNumberGenerator* _rng, int _popsize=2) :
-		pop(*sol, _popsize, false, false) {
-		scheduler = _scheduler;
-		id = _id,
-		method = nullptr;
-		methodContext = nullptr;
-		tmpSol = sol->clone();
-		for (auto &&t : startTime) t = 0;
-		rng = _rng;
-		isWorking = false;
-		terminate = false;
-	}
+	SchedulerWorker(class ParScheduler* _scheduler, int _id, const mh_solution *sol, mh_randomNumberGenerator* _rng, int _popsize=2);
 
 	/** Destructor of SchedulerWorker */
-	virtual ~SchedulerWorker() {
-		delete tmpSol;
-		delete rng;
-	}
+	virtual ~SchedulerWorker();
 
 	/**
 	 * Checks the globally best solution in the scheduler's population.
 	 * If it is better, the worker's incumbent solution is updated with probability #schpmig.
+	 * The global best solution is read from ParScheduler::incumbent without locking.
+	 * If #schsync is set, the global best solution committed up to the round #schlag
+	 * rounds before the current one is used instead, which needs no locking.
 	 */
 	void checkGlobalBest();
 
 	/**
-	 * This method is the main procedure of a worker, which is spawned as an own thread.
+	 * Adds data on the application of the method with the given index to the
+	 * worker's statistics, which are merged lazily into the scheduler's ones.
+	 * Does not need the scheduler's mutex. If #schsync is set, the data is kept in
+	 * uncommittedStats and only added when the result is committed, so that
+	 * applications whose results are discarded at termination are not counted.
+	 */
+	void addMethodStatistics(int methodIdx, int iter, double time, double netTime,
+			int success, double gain);
+
+	/** Adds the given data to the worker's statistics. */
+	void recordMethodStatistics(const MethodStatistics &s);
+
+	/**
+	 * This method is the main procedure of a worker, which runs concurrently to the other workers.
 	 * It contains the main loop consisting of the selection of the next method and solutions
 	 * to which it is applied, running it, and updating relevant data.
 	 * Additionally, the termination criteria are checked after each iteration by calling the
 	 * terminate() method.
 	 * mutex is used to ensure synchronization of the access to the optimization data
-	 * structures shared by the worker threads.
+	 * structures shared by the worker threads; it is, however, only held for scheduling
+	 * the next method and updating the data if ParScheduler::exclusiveUpdate() says so,
+	 * and otherwise only briefly for counting the iteration and logging. Method statistics are
+	 * collected per worker. A worker finding no method waits until some other worker has
+	 * completed a method, and only one waiting worker is woken up per completed method.
+	 * If #schsync is set, runSynchronized() is called instead of the main loop.
 	 */
 	void run();
+
+protected:
+	/**
+	 * Main loop of the worker if #schsync is set: method applications are performed in rounds,
+	 * and their results are queued and committed by ParScheduler::commitResults() in the
+	 * order of the tickets. A worker only waits for others if it would run ahead by
+	 * more than #schlag rounds or needs exclusive access.
+	 */
+	void runSynchronized();
+
+	/**
+	 * Runs the scheduled method on tmpSol, completes tmpSolResult, and updates the
+	 * worker's method statistics. If timed is false, the CPU time is not measured,
+	 * which is done for a whole batch by runBatch().
+	 */
+	void applyMethod(bool timed=true);
+
+	/**
+	 * Completes missing information in tmpSolResult except the reconsider flag.
+	 */
+	void completeResult();
+
+	/**
+	 * Performs a batch of method applications that do not need exclusive access, starting with
+	 * the scheduled one, each followed by updating the data and scheduling the next method,
+	 * see #schbatch. Returns the number of applications, which are not counted yet. Afterwards,
+	 * method is the last applied method, unless a method needing exclusive access has been
+	 * scheduled, which is then left to the main loop and indicated by #scheduled.
+	 */
+	int runBatch();
 };
 
 
@@ -130,6 +284,10 @@ public:
  * It maintains a methodPool consisting of SchedulerMethods that are iteratively
  * called. The scheduler is in particular responsible for deciding at which point in the optimization which
  * specific method is applied.
+ * Each worker selects the next method for its own solutions by getNextMethod(); there is no
+ * queue of method applications shared among or stolen by the workers, as the applications
+ * of a worker depend on each other. Parallelism within a method is provided by the
+ * work-stealing threadPool, see SchedulerMethodContext::parallel_for().
  */
 class ParScheduler : public Scheduler {
 	friend class SchedulerWorker;
@@ -162,45 +320,169 @@ protected:
 	 */
 	std::condition_variable cvNoMethodAvailable;
 
+	/** Number of workers waiting at #cvNoMethodAvailable, protected by #mutexNoMethodAvailable. */
+	int nWaiting = 0;
+
+	/** Number of completed method applications, protected by #mutexNoMethodAvailable.
+	 * Used by waiting workers to recognize that a method has been completed meanwhile. */
+	unsigned long int nCompleted = 0;
+
+	/** Mutex protecting the scheduler's method statistics while merging and using them. */
+	std::mutex statsMutex;
+
+	/**
+	 * The best solution of the scheduler's population published to the workers, which
+	 * compare their solutions with it and migrate it without locking mutex.
+	 * Updated together with the population, with mutex locked. The workers' ids are the reader indices.
+	 */
+	sharedIncumbent incumbent;
+
 	int _schthreads;		///< Mirrored mh parameter #schthreads for performance reasons.
 	bool _schsync;			///< Mirrored mh parameter #schsync for performance reasons.
+	int _schlag;			///< Mirrored mh parameter #schlag for performance reasons.
 	double _schpmig; 		///< Mirrored mh parameter #schpmig for performance reasons.
+	bool _schcancel;		///< Mirrored mh parameter #schcancel, false if #schsync is set.
+	int _schpin;			///< Mirrored mh parameter #schpin.
+	bool _schelastic;		///< Mirrored mh parameter #schelastic, false if #schsync is set.
+	double _schelint;		///< Mirrored mh parameter #schelint.
+	int _schbatch;			///< Mirrored mh parameter #schbatch, 1 if #schsync is set.
+	double _schbatcht;		///< Mirrored mh parameter #schbatcht.
+
+	/* Data for adapting the number of active workers if #schelastic is set. */
+	std::atomic<int> nActive;		///< Number of active workers, i.e., those with id < nActive.
+	std::mutex mutexActive;			///< Mutex for waiting of parked workers.
+	std::condition_variable cvActive;	///< Signals changes of nActive and termination to parked workers.
+	std::atomic<long long> idleMicros;	///< Time active workers waited for available methods since the last adaptation.
+	std::atomic<long long> lockWaitMicros;	///< Time active workers waited for mutex since the last adaptation.
+	std::atomic<long long> busyCpuMicros;	///< Thread CPU time of methods since the last adaptation.
+	std::atomic<long long> busyWallMicros;	///< Wall clock time of methods since the last adaptation.
+
+	std::atomic<int> nBatchIter;	///< Number of method applications in running batches not yet counted in nIteration, see #schbatch.
+	int nImprovements = 0;		///< Number of method applications yielding a better solution, protected by mutex.
+	double elasticTime = 0;		///< Wall clock time of the last adaptation.
+	int elasticIter = 0;		///< Iteration of the last adaptation.
+	int elasticImpr = 0;		///< nImprovements at the last adaptation.
+	double lastIterRate = 0;	///< Iterations per second in the last interval.
+	double lastImprRate = 0;	///< Improvements per second in the last interval.
+	int lastChange = 0;			///< Change of nActive at the last adaptation.
+	int elasticCooldown = 0;	///< Number of intervals in which no worker is activated.
+
+	/** Entry of the history of the number of active workers. */
+	struct ActiveWorkersEntry {
+		double time;			///< Wall clock time according to mhwctime().
+		int iteration;			///< Iteration.
+		int threads;			///< Number of active workers from then on.
+		double idle;			///< Measured fraction of idle time before the change.
+		double lockWait;		///< Measured fraction of time waiting for mutex before the change.
+		double cpuShare;		///< Measured share of the CPU obtained while running methods before the change.
+		double imprRate;		///< Measured improvements per second before the change.
+	};
+	std::vector<ActiveWorkersEntry> activeWorkersHistory;	///< Changes of the number of active workers.
+
+	std::mutex mutexWorkersReady;		///< Mutex for nWorkersReady.
+	std::condition_variable cvWorkersReady;	///< Signals that all workers have been created.
+	int nWorkersReady = 0;				///< Number of workers created in their threads.
+
+	/** Number of committed tickets if #schsync is set, protected by #mutex. */
+	unsigned long int nCommitted = 0;
+
+	/** Condition variable signaled with #mutex when further tickets have been committed. */
+	std::condition_variable cvCommitted;
+
+	/**
+	 * Copies of the global best solution at the beginning of the last #schlag+1 rounds
+	 * if #schsync is set; the one of round r is stored at index r%(#schlag+1).
+	 */
+	std::vector<mh_solution *> snapshots;
+
+	/**
+	 * Returns true if getNextMethod() and updateData() must be called for the given worker
+	 * with mutex locked, which is the default. A derived class may return false when
+	 * these methods only access data of the worker in its current state, using
+	 * updateGlobalBest() and SchedulerWorker::checkGlobalBest() for accessing the global
+	 * best solution, so that workers are not serialized.
+	 * If #schsync is set, the decision must only depend on the worker's own data.
+	 */
+	virtual bool exclusiveUpdate(const SchedulerWorker *worker) const {
+		return true;
+	}
+
+	/**
+	 * Returns true if the counted iterations together with those of the running batches
+	 * reach #titer or the limit given by #tciter, so that a batch has to end, see #schbatch.
+	 */
+	bool batchLimitReached() const {
+		int it = nIteration + nBatchIter;
+		return (_titer >= 0 && it >= _titer) || (_tciter >= 0 && it - iterBest >= _tciter);
+	}
+
+	/**
+	 * Commits the queued results of the workers in the order of their tickets as far as
+	 * they are available if #schsync is set: a solution offered as new global best solution
+	 * is adopted if it is better, the iteration is counted, the termination criteria are
+	 * checked, and the log entry is written. Must be called with mutex locked.
+	 */
+	void commitResults();
+
+	/**
+	 * Blocks until the given ticket is the next one to be committed or termination is
+	 * in progress, using the given lock on mutex. Returns false in the latter case.
+	 */
+	bool waitForTicket(std::unique_lock<std::mutex> &lck, unsigned long int ticket);
+
+	/**
+	 * Requests the methods running in the workers other than the given one to stop if the
+	 * incumbent solutions they were started with are worse than the global best solution,
+	 * see #schcancel. Called with mutex locked after publishing a new global best solution.
+	 */
+	void cancelDominatedMethods(int workerid);
+
+	/**
+	 * Signals the completion of a method to the workers waiting for an available method.
+	 * Only one of them is woken up, unless termination is in progress, in which case
+	 * also workers parked due to #schelastic are woken up.
+	 */
+	void notifyMethodCompleted(bool terminating);
 
 	/**
-	 * Counts the number of threads that are currently waiting for the working phase to begin.
-	 * Note: Only meaningful if #schsync is set to true.
+	 * Locks mutex, measuring the time spent waiting for it if #schelastic is set.
 	 */
-	int workersWaiting;
+	void lockMutexMeasured() {
+		if (!_schelastic) {
+			mutex.lock();
+			return;
+		}
+		if (mutex.try_lock())
+			return;
+		double t = mhwctime();
+		mutex.lock();
+		lockWaitMicros += (long long)((mhwctime() - t) * 1e6);
+	}
 
 	/**
-	 * Mutex used for blocking threads (together with the condition variable cvNotAllWorkersInPrepPhase)
-	 * if the synchronization of threads is active to wait after methods have been scheduled for all threads
-	 * and before these methods are actually run.
-	 * If the last thread reaches this point it sends a notification so that all threads can start the
-	 * next working phase.
+	 * Parks the worker with the given id while it is not among the active workers.
+	 * Returns false if termination is in progress.
 	 */
-	std::mutex mutexNotAllWorkersInPrepPhase;
+	bool waitUntilActive(int id);
 
 	/**
-	 * Condition variable used for blocking threads (together with the mutex mutexNotAllWorkersInPrepPhase)
-	 * if the synchronization of threads is active to wait after methods have been scheduled for all threads
-	 * and before these methods are actually run.
-	 * If the last thread reaches this point it sends a notification so that all threads can start the
-	 * next working phase.
+	 * Adapts the number of active workers if #schelint seconds have passed since the last
+	 * adaptation, see #schelastic. Called after each method application with mutex locked.
 	 */
-	std::condition_variable cvNotAllWorkersInPrepPhase;
+	void adaptActiveWorkers();
 
 	/**
-	 * Mutex used for ensuring an ordering of threads (together with the condition variable cvOrderThreads)
-	 * by which they have to start the optimization, i.e. by which a first method is assigned to them.
+	 * Sets the number of active workers and wakes up the parked ones to be activated.
 	 */
-	std::mutex mutexOrderThreads;
+	void setActiveWorkers(int n);
 
 	/**
-	 * Condition variable used for ensuring an ordering of threads (together with the mutex mutexOrderThreads)
-	 * by which they have to start the optimization, i.e. by which a first method is assigned to them.
+	 * Runs the worker with the given id in the calling thread: the thread is pinned to
+	 * the given CPU unless it is negative, the worker is created with a random number
+	 * generator with the given seed, and after all workers have been created, it is run.
+	 * Finally, the thread's former affinity is restored.
 	 */
-	std::condition_variable cvOrderThreads;
+	void runWorker(int id, unsigned int seed, int cpu);
 
 	/**
 	 * Rethrows the exceptions that have possibly occurred in the threads and have been collected in the worker_exceptions vector.
@@ -238,6 +520,54 @@ public:
 		mutex.unlock();
 	}
 
+	/** Function that ensures mutual exclusion for accessing the method statistics. */
+	void statisticsLock() override {
+		statsMutex.lock();
+	}
+
+	/** Function that ends the mutual exclusive access to the method statistics. */
+	void statisticsUnlock() override {
+		statsMutex.unlock();
+	}
+
+	/** Adds the statistics collected by the workers to the scheduler's ones. */
+	void mergeMethodStatistics() override;
+
+	/** Requests the methods running in all workers to stop as soon as possible
+	 * and wakes up parked workers. */
+	void cancelMethods() override;
+
+	/** Prints the statistics and, if #schelastic is set, the numbers of active
+	 * workers over time. */
+	void printStatistics(std::ostream &ostr) override;
+
+	using Scheduler::updateMethodStatistics;
+
+	/**
+	 * Updates the statistics data after applying a method in the given worker.
+	 * The data are collected in the worker and merged lazily.
+	 * @param worker current worker object
+	 * @param methodTime CPU time used by the method call
+	 */
+	virtual void updateMethodStatistics(SchedulerWorker *worker, double methodTime);
+
+	/**
+	 * Offers the worker's incumbent pop[0] as new global best solution.
+	 * It replaces the best solution in the scheduler's population if it is better, locking
+	 * mutex if it is not held by the worker; solutions not better than #incumbent are
+	 * rejected without locking. If #schsync is set, a copy is queued with the
+	 * worker's current result and only considered when the result is committed.
+	 */
+	void updateGlobalBest(SchedulerWorker *worker);
+
+	/**
+	 * Offers an improved solution reported by a method still running in the given worker,
+	 * see SchedulerMethodContext::reportImprovement(), as new global best solution in the
+	 * same way as updateGlobalBest(); not used if #schsync is set, as results must then
+	 * be committed in order.
+	 */
+	void offerImprovement(int workerid, mh_solution &sol);
+
 	/**
 	 * Updates the worker->tmpSol, worker->pop, where the worker is given by idx, and the scheduler's population.
 	 * If the flag updateSchedulerData is set to true, global data, such as the scheduler's
@@ -246,24 +576,13 @@ public:
 	 * #schpmig.
 	 * If it is false, only the worker's population and no data is exchanged between the scheduler's and the
 	 * worker's populations.
-	 * If storeResult is true, a new MethodApplicationResult object storing the result of the last
-	 * method application is appended to the SchedulerWorker's result list.
-	 * This method is called with mutex locked.
+	 * The flag storeResult is reserved for schedulers keeping a history of results and currently
+	 * always false.
+	 * This method is called with mutex locked if exclusiveUpdate() returns true for the worker.
 	 * TODO: When worse solutions are actively set to be accepted via result.accept,
 	 * a so far best solution is currently not yet stored and gets lost!
 	 */
 	virtual void updateData(int idx, bool updateSchedulerData, bool storeResult) = 0;
-
-	/**
-	 * Updates the global data based on the entries in the results vectors of the workers.
-	 * It needs to be ensured that the result of this update is always the same independent from the
-	 * order of the workers.
-	 * Furthermore, each worker's incumbent solution is updated to the globally best one by
-	 * probability #schpmig.
-	 * If clearResults is set to true, the vector is cleared after the results have been processed.
-	 * Otherwise, the results remain in the vector.
-	 */
-	virtual void updateDataFromResultsVectors(bool clearResults) = 0;
 };
 
 } // end of namespace mh
@@ -0,0 +1,114 @@
+/*! \file mh_partempering.h
+  \brief Parallel tempering, i.e., replica exchange simulated annealing.
+*/
+
+#ifndef MH_PARTEMPERING_H
+#define MH_PARTEMPERING_H
+
+#include <exception>
+#include <vector>
+#include "mh_lsbase.h"
+#include "mh_random.h"
+
+namespace mh {
+
+/** \ingroup param
+    Number of chains (replicas) in parallel tempering, run in parallel by
+    threads of the shared threadPool.
+ */
+extern int_param ptchains;
+
+/** \ingroup param
+    Number of Metropolis steps performed by each chain between two
+    replica exchange phases in parallel tempering.
+ */
+extern int_param ptsweep;
+
+/** \ingroup param
+    Initial ratio between the temperatures of neighboring chains in
+    parallel tempering. The lowest temperature is given by #satemp.
+ */
+extern double_param ptratio;
+
+/** \ingroup param
+    Target acceptance rate of replica exchanges in parallel tempering.
+    The spacing of the temperature ladder is adapted so that exchanges
+    between all neighboring chains are accepted at about this rate.
+    If 0, the temperature ladder is kept fixed.
+ */
+extern double_param ptacc;
+
+/** Parallel tempering, also known as replica exchange simulated annealing.
+	A number of #ptchains Markov chains (replicas) is run at a ladder of
+	temperatures T_0 < T_1 < ... < T_{K-1} with T_0=#satemp, each one
+	with an own random number generator, and chains are run in parallel
+	by idle threads of threadPool::global(), so that results
+	only depend on the seed. During each iteration, every chain
+	performs #ptsweep Metropolis steps with the same neighbor selection
+	as simulatedAnnealing; then the solutions of neighboring chains are
+	exchanged with the usual replica exchange probability by exchanging
+	pointers. The temperature ladder adapts its spacing to the observed
+	exchange acceptance rates, see #ptacc.
+	The best solution found by any chain is kept at index 0 of the
+	population; termination and logging are as in mh_advbase, with one
+	iteration corresponding to one sweep plus exchange phase. */
+class parallelTempering : public lsbase
+{
+protected:
+	/** The data of a single chain. */
+	struct chain
+	{
+		mh_solution *cur = nullptr;	///< Current solution of the chain.
+		mh_solution *tmp = nullptr;	///< Temporary solution for neighbors.
+		mh_solution *best = nullptr;	///< Best solution of the chain during the current sweep.
+		bool bestChanged = false;	///< Set if best has been improved in the current sweep.
+		double T = 0;			///< Temperature of the chain.
+		mh_randomNumberGenerator rng;	///< The chain's random number generator.
+		int nSteps = 0;		///< Number of performed Metropolis steps.
+		int nAccepted = 0;	///< Number of accepted moves.
+		std::exception_ptr exception;	///< Exception possibly occurred in the chain's thread.
+	};
+
+	std::vector<chain *> chains;	///< The chains, ordered by increasing temperatures.
+	std::vector<int> nExchangeTries;	///< Exchange attempts between chains k and k+1.
+	std::vector<int> nExchanges;		///< Performed exchanges between chains k and k+1.
+	std::vector<int> nWindowTries;	///< Exchange attempts since the last ladder adaptation.
+	std::vector<int> nWindowExchanges;	///< Performed exchanges since the last ladder adaptation.
+
+	int _ptsweep;		///< Mirrored mhlib parameter #ptsweep.
+	double _ptacc;		///< Mirrored mhlib parameter #ptacc.
+
+	/** Performs #ptsweep Metropolis steps in the given chain. Called in the chain's thread. */
+	virtual void sweep(chain *c);
+	/** Attempts to exchange the solutions of neighboring chains. */
+	virtual void exchangeReplicas();
+	/** Adapts the spacing of the temperature ladder according to the exchange rates. */
+	virtual void adaptLadder();
+	/** Metropolis criterion for a new solution n compared to the old solution o
+		at temperature T. */
+	virtual bool accept(mh_solution *o, mh_solution *n, double T);
+
+public:
+	/** The constructor.
+		An initialized population already containing solutions
+		must be given. Note that the population is NOT owned by the
+		algorithm and will not be deleted by its destructor. */
+	parallelTempering(pop_base &p, const std::string &pg="");
+	/** Another constructor.
+		Creates an empty algorithm that can only be used as a template. */
+	parallelTempering(const std::string &pg="") : lsbase(pg), _ptsweep(0), _ptacc(0) {}
+	/** The destructor deletes the chains. */
+	virtual ~parallelTempering();
+	/** Create new parallelTempering object. */
+	mh_advbase *clone(pop_base &p, const std::string &pg="")
+		{ return new parallelTempering(p,pg); }
+	/** Performs a sweep in all chains in parallel followed by replica exchanges. */
+	void performIteration() override;
+	/** Prints the usual statistics and the final temperature ladder with
+		the acceptance and exchange rates. */
+	void printStatistics(std::ostream &ostr) override;
+};
+
+} // end of namespace mh
+
+#endif //MH_PARTEMPERING_H
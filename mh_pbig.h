@@ -1,10 +1,12 @@
 /*! \file mh_pbig.h
- \brief Scheduler class implementing a Population-Based Iterated Greedy Algorithm (PBIG).
+ \brief Scheduler classes implementing a Population-Based Iterated Greedy Algorithm (PBIG),
+ sequentially and in parallel.
  */
 
-#ifndef MH_PBIGH
+#ifndef MH_PBIG_H
 #define MH_PBIG_H
 
+#include "mh_parscheduler.h"
 #include "mh_scheduler.h"
 
 namespace mh {
@@ -68,6 +70,76 @@ public:
 			bool updateSchedulerData, bool storeResult) override;
 };
 
+
+//--------------------------- ParPBIG ------------------------------
+
+/** Parallel variant of PBIG on the basis of the ParScheduler class.
+ * Methods are added as for PBIG. As the construction and the D&R of the individual solutions
+ * within a generation are independent of each other, they are performed concurrently by up
+ * to #schthreads threads of the shared threadPool. Each solution has its own method selectors
+ * and its own random number generator, and the methods are selected before and the results
+ * are committed after the parallel phase in the order of the solutions: the method statistics,
+ * the iteration counter, the termination criteria and the log are updated for each method
+ * application, and the newly derived population is merged into the current one as in PBIG.
+ * Thus, the outcome for a given seed does not depend on the number of threads, provided
+ * termination does not depend on measured times. If termination is recognized in the middle
+ * of a generation, the results of the remaining method applications are discarded.
+ */
+class ParPBIG : public ParScheduler {
+
+protected:
+	/** SchedulerMethodSelectors for the construction heuristic(s) for each solution. */
+	std::vector<SchedulerMethodSelector *> constheu;
+	/** A SchedulerMethodSelector for the D&R methods for each solution in the population. */
+	std::vector<SchedulerMethodSelector *> destrec;
+
+	std::vector<mh_solution *> pop2;	///< The newly derived population.
+
+	/** The random number generators used for the individual solutions. */
+	std::vector<mh_randomNumberGenerator *> rngs;
+
+	/** Data of a method application in the current generation. */
+	struct Application {
+		SchedulerMethod *method;			///< The method to be applied.
+		SchedulerMethodContext *context;	///< Its context.
+		SchedulerMethodResult result;		///< The result.
+		double time;						///< The thread CPU time used.
+	};
+	std::vector<Application> applications;	///< Method applications of the current generation.
+
+	/** Applies the method selected for solution s to pop2[s] in the calling thread. */
+	void applyMethod(int s);
+
+public:
+	/**
+	 * Constructor: Initializes the scheduler.
+	 * @param p The population to use.
+	 * @param destRecMethods The number of D&R methods to be added and used.
+	 * @param pg Parameter group.
+	 */
+	ParPBIG(pop_base &p, int destRecMethods, const std::string &pg = "");
+
+	/** Destructor for deleting dynamically allocated objects. */
+	~ParPBIG();
+
+	/**
+	 * Selects the next method for the solution with index idx by its construction or D&R
+	 * method selector.
+	 */
+	SchedulerMethodAndContext getNextMethod(int idx) override;
+
+	/**
+	 * Actually performs the parallel PBIG.
+	 */
+	void run() override;
+
+	/**
+	 * Not used, as the data are updated when committing the results.
+	 */
+	void updateData(int idx, bool updateSchedulerData, bool storeResult) override {
+	}
+};
+
 } // end of namespace mh
 
-#endif /* MH_SCHEDULER_H */
+#endif /* MH_PBIG_H */
@@ -70,9 +70,22 @@ public:
 	void mutate(int count);
 	/** Calls crossover according to the permxop() parameter. */
 	void crossover(const mh_solution &parA,const mh_solution &parB);
+	/** Path relinking step: a randomly chosen element that is not at
+		its position in the guiding solution is swapped there. */
+	bool pathRelinkStep(const mh_solution &guide) override;
+	/** Returns the change of the objective value by a swapMove.
+		The default implementation swaps the elements, evaluates the solution
+		completely, and swaps them back; derived classes should override
+		it with an incremental evaluation. */
+	double delta_obj(const nhmove &m) override;
 	/** Function to apply a certain move.
 	        This will only work with a swapMove. */
 	void applyMove(const nhmove &m);
+	/** Creates a swapMove. */
+	nhmove *createMove() const override
+		{ return new swapMove; }
+	/** Chooses two different random positions to be swapped; works only with a swapMove. */
+	void randomMove(nhmove &m) override;
 };
 
 } // end of namespace mh
@@ -82,6 +82,11 @@ public:
 		The caller has to take care to delete or store the returned
 		prior solution. Population data is updated. */
 	mh_solution *replace(int index, mh_solution *newchrom);
+	/** Replaces all solutions at once by exchanging the solution arrays in O(1).
+		The array passed must have been allocated by new[] with size() elements.
+		A kept solution is moved by pointer, the hash table and the best solution
+		are determined anew in a single pass. */
+	void replaceAll(mh_solution **&newchroms, int keep=-1) override;
 	/** Copy the given solution into the solution at position index in
 	 * the population and update population data.
 	 */
@@ -94,6 +94,14 @@ public:
 		The caller has to take care to delete or store the returned
 		prior solution. */
 	virtual mh_solution *replace(int index, mh_solution *newchrom) = 0;
+	/** Replaces all solutions at once by the size() solutions in the given array.
+		Afterwards, newchroms refers to an array with the prior solutions, which
+		the caller has to take care of. If keep is a valid index, the solution at
+		this index is kept and moved to index 0 of the new population, and the
+		solution given at index 0 is passed back instead (e.g., for elitism).
+		Population data is updated. This implementation replaces one solution
+		after the other, derived classes may do it more efficiently. */
+	virtual void replaceAll(mh_solution **&newchroms, int keep=-1);
 	/** Copy the given solution into the solution at position index in
 	 * the population and update population data.
 	 */
@@ -0,0 +1,151 @@
+/*! \file mh_portfolio.h
+  \brief A portfolio of metaheuristics running concurrently and
+  sharing their best solutions. */
+
+#ifndef MH_PORTFOLIO_H
+#define MH_PORTFOLIO_H
+
+#include <atomic>
+#include <exception>
+#include <vector>
+#include "mh_advbase.h"
+#include "mh_c11threads.h"
+#include "mh_incumbent.h"
+#include "mh_param.h"
+#include "mh_random.h"
+
+namespace mh {
+
+/** \ingroup param
+    Number of algorithms of the portfolio. Algorithm i=1,...,#pfn is
+    configured by the parameter group "pf<i>", e.g., pf1.mhalg 5. */
+extern int_param pfn;
+
+/** \ingroup param
+    Resource share of an algorithm of the portfolio, given in its
+    parameter group; the CPU time is distributed among the algorithms
+    proportionally to their shares if there are fewer threads than
+    algorithms or more threads than processors. */
+extern double_param pfshare;
+
+/** \ingroup param
+    Indicates if better solutions found by other algorithms of the portfolio
+    are imported into the population of an algorithm, given in its
+    parameter group. */
+extern bool_param pfimport;
+
+/** \ingroup param
+    Number of threads running the algorithms of the portfolio including the
+    calling thread; 0 means the minimum of #pfn and the number of
+    processors available to the process. */
+extern int_param pfthreads;
+
+/** \ingroup param
+    Wall clock time in seconds for which a thread runs an algorithm of the
+    portfolio before it selects again the algorithm that has used the
+    smallest CPU time relative to its share. */
+extern double_param pfslice;
+
+/** A portfolio of metaheuristics running concurrently.
+	The #pfn algorithms are created by create_mh() for the parameter groups
+	"pf1", "pf2",... and work on own populations, which are initialized
+	by the constructor. They are run by #pfthreads threads, the calling
+	thread and threads of threadPool::global(), each performing iterations
+	of one algorithm for a time slice of #pfslice seconds and then
+	selecting the algorithm that is not run by another thread and has
+	used the smallest CPU time divided by its share #pfshare. If there are
+	more threads than processors and all processors are busy, a thread waits
+	instead of running an algorithm that is ahead of a running one in this
+	respect, so that the shares are also kept in this case. After each
+	iteration, the best solution of the algorithm is published in a
+	sharedIncumbent if it is better than the published one, and a
+	better published solution is imported into its population, replacing
+	a solution determined by replaceIndex(), unless #pfimport is unset for
+	the algorithm. The portfolio's population receives all published
+	solutions, and log entries are written for them.
+	The algorithms terminate according to their own termination criteria,
+	while the portfolio terminates when all algorithms have terminated or
+	its own criteria are fulfilled, where the iterations of all
+	algorithms are counted together and #tobj and #tciter refer to the
+	published solutions. As the CPU times of all threads sum up, time
+	limits (#ttime) should usually be given in wall clock time (#wctime).
+	Each algorithm uses its own random number generator, but results
+	depend on the timing of the threads.
+	As the algorithms are run iteration by iteration, only those
+	created by create_mh() can be members of the portfolio; Scheduler
+	based algorithms like GVNS, whose performIteration() is not
+	implemented, are not supported. */
+class portfolio : public mh_advbase
+{
+protected:
+	/** The data of an algorithm of the portfolio. */
+	struct member
+	{
+		std::string pgroup;			///< Parameter group of the algorithm.
+		pop_base *spop = nullptr;	///< Population of the algorithm.
+		mh_advbase *alg = nullptr;	///< The algorithm.
+		mh_solution *imported = nullptr;	///< Temporary solution for importing.
+		double share = 1;			///< Mirrored mhlib parameter #pfshare.
+		bool import = true;			///< Mirrored mhlib parameter #pfimport.
+		mh_randomNumberGenerator rng;	///< The algorithm's random number generator.
+		double usedTime = 0;		///< CPU time used so far.
+		bool running = false;		///< Set while the algorithm is run by a thread.
+		bool finished = false;		///< Set when the algorithm has terminated.
+		unsigned long int version = 0;	///< Version of the shared solution known to the algorithm.
+		int nExports = 0;			///< Number of published solutions.
+		int nImports = 0;			///< Number of imported solutions.
+		std::exception_ptr exception;	///< Exception possibly occurred in the algorithm.
+	};
+
+	std::vector<member *> members;	///< The algorithms.
+	sharedIncumbent incumbent;	///< The best solution published by the algorithms.
+	std::mutex mutex;			///< Protects the selection of algorithms, the population, and logging.
+	std::condition_variable cv;	///< Signals algorithms becoming available.
+	std::atomic<int> nIter;		///< Number of iterations of all algorithms.
+	std::atomic<int> nIterBest;	///< Value of nIter when the published solution was found.
+	std::atomic<bool> finish;	///< Set when the portfolio terminates.
+	int nCpus = 1;				///< Number of processors available to the threads.
+	int nRunning = 0;			///< Number of algorithms currently run, protected by mutex.
+
+	int _pfthreads;		///< Mirrored mhlib parameter #pfthreads.
+	double _pfslice;	///< Mirrored mhlib parameter #pfslice.
+
+	/** Selects an algorithm and runs it for a time slice in the calling thread,
+		which uses the given reader index of the incumbent. Returns false if
+		no algorithm remains. */
+	virtual bool runSlice(int reader);
+	/** Publishes the best solution of the algorithm or imports the published
+		one if it is better, after an iteration of the algorithm. */
+	virtual void exchange(member *m, int reader);
+	/** Adds the published solution to the portfolio's population and writes
+		a log entry; mutex must be held. */
+	virtual void updateBest(mh_solution *sol);
+
+public:
+	/** The constructor.
+		An initialized population already containing solutions
+		must be given. Note that the population is NOT owned by the
+		algorithm and will not be deleted by its destructor. */
+	portfolio(pop_base &p, const std::string &pg="");
+	/** Another constructor.
+		Creates an empty algorithm that can only be used as a template. */
+	portfolio(const std::string &pg="") : mh_advbase(pg), nIter(0), nIterBest(0),
+		finish(false), _pfthreads(0), _pfslice(0) {}
+	/** The destructor deletes the algorithms and their populations. */
+	virtual ~portfolio();
+	/** Create new portfolio object. */
+	mh_advbase *clone(pop_base &p, const std::string &pg="")
+		{ return new portfolio(p,pg); }
+	/** Runs the algorithms in #pfthreads threads until termination. */
+	void run() override;
+	/** Runs the selected algorithm for a time slice in the calling thread. */
+	void performIteration() override;
+	/** Checks the portfolio's termination criteria; may be called by all threads. */
+	bool terminate() override;
+	/** Prints the usual statistics and those of the algorithms. */
+	void printStatistics(std::ostream &ostr) override;
+};
+
+} // end of namespace mh
+
+#endif //MH_PORTFOLIO_H
@@ -7,9 +7,13 @@
 #define MH_SCHEDMETH_H
 
 #include <assert.h>
+#include <atomic>
+#include <functional>
 #include <string>
 
 #include "mh_solution.h"
+#include "mh_threadpool.h"
+#include "mh_util.h"
 
 namespace mh {
 
@@ -33,6 +37,28 @@ struct SchedulerMethodResult {
 	}
 };
 
+//--------------------------- CancellationToken ------------------------------
+
+/** Token by which a scheduler requests a running method to stop as soon as possible,
+ * see SchedulerMethodContext::shouldStop(). May be used concurrently from multiple threads. */
+class CancellationToken {
+public:
+	/** Requests cancellation. */
+	void cancel() {
+		cancelled.store(true, std::memory_order_relaxed);
+	}
+	/** Withdraws a cancellation request. */
+	void reset() {
+		cancelled.store(false, std::memory_order_relaxed);
+	}
+	/** Returns true if cancellation has been requested. */
+	bool isCancelled() const {
+		return cancelled.load(std::memory_order_relaxed);
+	}
+protected:
+	std::atomic<bool> cancelled{false};	///< Indicates that cancellation has been requested.
+};
+
 //--------------------------- SchedulerMethodContext ------------------------------
 
 /** Structure that is passed when a SchedulerMethod is applied. It provides additional information
@@ -54,11 +80,63 @@ struct SchedulerMethodContext {
 	 * successive calls. If an object exists, it will finally be deleted by
 	 * the destructor of the SchedulerMethodContext. */
 	UserData *userData = nullptr;
+	/** Token by which the scheduler requests the method to stop, set before each call (read only). */
+	const CancellationToken *cancelToken = nullptr;
+	/** Time in terms of mhtime(wctime) at which the method should stop at the latest,
+	 * or a negative value for no deadline; set before each call (read only). */
+	double deadline = -1;
+	bool wctime = false;	///< Indicates if deadline refers to the wall clock time (read only).
+	timeLimitChecker deadlineChecker;	///< Amortizes reading the clock in shouldStop().
+	/** Thread pool in which the method may execute parts of its work in parallel,
+	 * see getPool(); nullptr, which is kept by the schedulers, stands for
+	 * threadPool::global(). */
+	threadPool *pool = nullptr;
+	/** Function by which the scheduler is informed about an improved solution found by the
+	 * running method before it returns, see reportImprovement(); set by the scheduler
+	 * (read only), may be empty. */
+	std::function<void(int workerid, mh_solution &sol)> improvementCallback;
+	/** Returns true if the method should return as soon as possible, as the scheduler has
+	 * requested its cancellation, e.g., due to termination, or the deadline has been reached.
+	 * The method should then return a valid solution, e.g., the best one found so far.
+	 * Cheap enough for being called in inner loops. */
+	bool shouldStop() {
+		return (cancelToken != nullptr && cancelToken->isCancelled()) ||
+			(deadline >= 0 && deadlineChecker.reached(deadline, wctime));
+	}
+	/** Passes an improved solution found by the running method to the scheduler, which may
+	 * then publish it as new best solution before the method returns. */
+	void reportImprovement(mh_solution &sol) {
+		if (improvementCallback)
+			improvementCallback(workerid, sol);
+	}
+	/** Returns the thread pool to be used by the method. */
+	threadPool &getPool() {
+		return pool != nullptr ? *pool : threadPool::global();
+	}
+	/** Calls f(lo,hi) for ranges of grain elements partitioning [begin,end) in parallel
+	 * by otherwise idle threads of the pool, e.g., for scanning a neighborhood;
+	 * see threadPool::parallel_for(). */
+	void parallel_for(int begin, int end, int grain, const std::function<void(int lo, int hi)> &f) {
+		getPool().parallel_for(begin, end, grain, f);
+	}
 	/** Destructor deletes userData object if one is left. */
 	~SchedulerMethodContext() {
 			if (userData != nullptr)
 					delete userData;
 	}
+	/** Exchanges the contents with another context, including the ownership of userData. */
+	void swap(SchedulerMethodContext &c) {
+		std::swap(workerid,c.workerid);
+		std::swap(callCounter,c.callCounter);
+		std::swap(incumbentSol,c.incumbentSol);
+		std::swap(userInt,c.userInt);
+		std::swap(userData,c.userData);
+		std::swap(cancelToken,c.cancelToken);
+		std::swap(deadline,c.deadline);
+		std::swap(wctime,c.wctime);
+		std::swap(pool,c.pool);
+		std::swap(improvementCallback,c.improvementCallback);
+	}
 };
 
 //--------------------------- SchedulerMethod ------------------------------
@@ -130,8 +208,13 @@ public:
 	}
 
 	/** Apply the method for the given solution, passing par. The method returns true if the solution
-	 * has been changed and false otherwise.*/
+	 * has been changed and false otherwise. If the method should already stop before being started,
+	 * it is not called and the solution remains unchanged. */
 	void run(mh_solution *sol, SchedulerMethodContext &context, SchedulerMethodResult &result) const {
+		if (context.shouldStop()) {
+			result.changed = false;
+			return;
+		}
 		((static_cast<SpecSol *>(sol))->*pmeth)(par, context, result);
 	}
 };
@@ -25,6 +25,12 @@ namespace mh {
  */
 extern int_param lmethod;
 
+/** \ingroup param
+ * Exploration constant of the upper confidence bound strategy used by
+ * SchedulerMethodSelector::MSSelfadaptive; 0 means pure exploitation.
+ */
+extern double_param schucb;
+
 /** The maximum number of possible "embedded" method applications. E.g., in GVNS,
  * the VND's methods are embedded in the outer VNS shaking methods and
  * the number of embedded method applications is 2. The individual VND or VNS
@@ -59,7 +65,16 @@ public:
 		MSRandomRep,
 		/** Uniform random selection, but each just once; finally return nullptr. */
 		MSRandomOnce,
-		/** Random selection with self-adaptive probabilities. */
+		/** Self-adaptive selection by the upper confidence bound (UCB1) strategy,
+		 * with the average gain per CPU second of a method as its reward; the time
+		 * of a GVNS shaking method includes the subsequent VND, as its gain does.
+		 * Each method is first applied once, then the one maximizing its
+		 * reward, normalized by the maximum reward, plus #schucb times
+		 * sqrt(ln(N)/n) is chosen, with n being the number of applications
+		 * of the method and N the total number of applications of all methods.
+		 * Methods not marked as adaptive get the average normalized reward of the
+		 * adaptive ones. Methods for which doNotReconsiderLastMethod is called
+		 * are disabled as in MSRandomRep. */
 		MSSelfadaptive,
 		/** Random selection, where the probability is indirect proportional to the time used until now for this method. */
 		MSTimeAdaptive
@@ -77,14 +92,12 @@ protected:
 	std::set<int> activeSeqRep;	///< Active methods indices in case of MSSequentialRep. Not used by other strategies.
 	std::set<int>::iterator lastSeqRep; /// Last method iterator in activeSeqRep. Only used by MSSequtionRep.
 	std::vector<double> probabilityWeights; ///< Probability intervals for the methods, only used for adaptive methods
+	double _schucb;	///< Mirrored mhlib parameter #schucb of the scheduler.
 
 public:
 
 	/** Initialize SchedulerMethodSelector for given strategy. */
-	SchedulerMethodSelector(Scheduler *scheduler_, MethodSelStrat strategy_)
-		: scheduler(scheduler_), strategy(strategy_), lastMethod(-1), firstActiveMethod(0),
-		  lastSeqRep(activeSeqRep.end()) {
-	}
+	SchedulerMethodSelector(Scheduler *scheduler_, MethodSelStrat strategy_);
 
 	/** Cleanup. */
 	virtual ~SchedulerMethodSelector() {
@@ -114,6 +127,14 @@ public:
 	 * Typically called when a new incumbent solution is obtained to reconsider all methods. */
 	void reset(bool hard);
 
+	/** Select a method by the upper confidence bound strategy of MSSelfadaptive;
+	 * returns its index in methodList. */
+	int selectUCB();
+
+	/** Exchange the methods at positions i and j in methodList together with
+	 * their contexts. */
+	void swapMethods(int i, int j);
+
 	/** Mark the last method to not be reconsidered until reset() is called. */
 	void doNotReconsiderLastMethod();
 
@@ -183,6 +204,18 @@ protected:
 	 */
 	bool finish;
 
+	/**
+	 * Token by which running methods are requested to stop, see SchedulerMethodContext::shouldStop().
+	 * It is cancelled by cancelMethods() when termination is initiated.
+	 */
+	CancellationToken cancelToken;
+
+	/**
+	 * Prepares the given context for running a method by setting the given cancellation token
+	 * and the deadline according to #ttime.
+	 */
+	void prepareMethodContext(SchedulerMethodContext *context, const CancellationToken *token);
+
 public:
 	/**
 	 * Constructor: Initializes the scheduler.
@@ -263,6 +296,22 @@ public:
 	virtual void mutexUnlock() {
 	}
 
+	/** Function that can be overriden for achieving mutual exclusion when accessing the
+	 * method statistics nIter, totTime, totNetTime, nSuccess, and sumGain. */
+	virtual void statisticsLock() {
+	}
+
+	/** Function that can be overriden for ending the mutual exclusive access to the method statistics. */
+	virtual void statisticsUnlock() {
+	}
+
+	/** Adds method statistics that have been collected separately, e.g., by the workers of a
+	 * ParScheduler, to nIter, totTime, totNetTime, nSuccess, and sumGain. Called before the
+	 * method statistics are used, between statisticsLock() and statisticsUnlock().
+	 * The implementation in this class does nothing. */
+	virtual void mergeMethodStatistics() {
+	}
+
 	/**
 	 * Returns true, if the external application has requested the optimization to terminate,
 	 * if the scheduler's terminate flag has been set to true,
@@ -272,6 +321,14 @@ public:
 	 */
 	virtual bool terminateMethod();
 
+	/**
+	 * Requests all running methods to stop as soon as possible. Called when termination is
+	 * initiated by terminate() or terminateMethod(). The method is thread-safe.
+	 */
+	virtual void cancelMethods() {
+		cancelToken.cancel();
+	}
+
 	/** Updates the statistics data after applying a method. */
 	void updateMethodStatistics(mh_solution *origsol, mh_solution *tmpsol, int methodIdx,
 			double methodTime, SchedulerMethodResult &tmpSolResult);
@@ -329,6 +386,16 @@ public:
 	 */
 	virtual SchedulerMethodAndContext getNextMethod(int idx);
 
+	/**
+	 * Returns true if a solution obtained by the given method is discarded anyway when it
+	 * is not better than the incumbent, so that the check whether it is better may rely on a
+	 * bounded evaluation stopping early, see mh_solution::boundedObjective().
+	 * The implementation in this class returns false.
+	 */
+	virtual bool boundedAcceptance(const SchedulerMethod *method) {
+		return false;
+	}
+
 	/**
 	 * Updates the schedulers internal data (e.g., population) in accordance to the last method application.
 	 * The parameters are specific to the implementations in derived classes.
@@ -6,6 +6,7 @@
 #define MH_SIMANNEAL_H
 
 #include "mh_lsbase.h"
+#include "mh_nhmove.h"
 
 namespace mh {
 
@@ -28,15 +29,43 @@ extern int_param sacint;
  */
 extern double_param satemp;
 
+/** \ingroup param
+    Use move based simulated annealing.
+    Instead of copying the current solution and evaluating a neighbor
+    anew, a random move is sampled via gaopsProvider::randomMove(), evaluated
+    via gaopsProvider::delta_obj(), and only applied when accepted.
+    The solution class must support createMove(). Note that the default
+    delta_obj() of binStringSol and permSol evaluates the solution
+    completely, so that only the copying of solutions is saved unless the
+    derived class provides an incremental delta_obj().
+ */
+extern bool_param samove;
+
 /** Simulated annealing.
 	During each iteration, a move in the neighbourhood is performed
 	and the current solution is replaced if the new solution is not
-	worse, or if an acceptance method allows the move. */
+	worse, or if an acceptance method allows the move.
+	If parameter #samove is set, the current solution is kept separately
+	and modified in place by accepted moves only, while the best solution
+	found is maintained at index 0 of the population. */
 class simulatedAnnealing : public lsbase
 {
 protected:
 	/** Temperature of the annealing process. */
 	double T=0;
+	/** Current solution in move based mode, nullptr otherwise. */
+	mh_solution *curSol=nullptr;
+	/** Move object reused in move based mode. */
+	nhmove *move=nullptr;
+
+	/** Performs a single iteration in move based mode. */
+	virtual void performMove();
+	/** Draws a random threshold -T*ln(u) for u uniform in [0,1).
+		A deterioration by delta>0 is accepted iff delta does not exceed
+		the threshold, which happens with the Metropolis probability
+		exp(-delta/T); moves that do not worsen the solution are accepted
+		without drawing a threshold. */
+	double acceptanceThreshold();
 
 public:
 	/** The constructor.
@@ -47,6 +76,8 @@ public:
 	/** Another constructor.
 		Creates an empty Algorithm that can only be used as a template. */
 	simulatedAnnealing(const std::string &pg="") : lsbase(pg) {}
+	/** The destructor. */
+	virtual ~simulatedAnnealing();
 	/** Create new simulatedAnnealing.
 		Returns a pointer to a new simulatedAnnealing. */
 	mh_advbase *clone(pop_base &p, const std::string &pg="")
@@ -8,6 +8,7 @@
 #define MH_SOLUTION_H
 
 #include <iostream>
+#include <memory>
 #include "mh_param.h"
 
 namespace mh {
@@ -18,6 +19,7 @@ namespace mh {
 extern bool_param maxi;
 
 class mh_base; // abstract class for algorithms
+class evalCache; // cache for objective values, see mh_evalcache.h
 
 /** Abstract class representing the bare solution independently from any algorithm.
 	A concrete class must be derived for a specific problem.
@@ -38,6 +40,22 @@ protected:
 		to objective(). */
 	virtual double objective() = 0;
 
+	/** Objective function with early termination.
+		Determines the objective value as objective() does, except that the evaluation
+		may be stopped as soon as it becomes clear that the objective value is worse
+		than the given bound. In this case, any value worse than bound may be returned.
+		If the solution's objective value is not worse than bound, the exact value must
+		be returned. Should be overloaded when this allows a substantially faster
+		evaluation; the default implementation just calls objective().
+		Must not be called directly, use obj(double) instead. */
+	virtual double boundedObjective(double bound)
+		{ return objective(); }
+
+	/** Determines the objective value by means of the evaluation cache ecache.
+		Called by obj() if a cache is attached; objective() is only called
+		if no equal solution is found in the cache. */
+	double cachedObj();
+
 public:
 	/// Parameter group
 	std::string pgroup = "";
@@ -48,6 +66,9 @@ public:
 	 * your solution does not have a dedicated length.
 	 */
 	int length = 1;
+	/** Possible evaluation cache consulted by obj() before calling objective().
+		It is usually set by the algorithm, see parameter #ecsize. */
+	std::shared_ptr<evalCache> ecache;
 
 	/** Constructor for uninitialized solution.
 		Must also be defined for a concrete solution class.
@@ -67,7 +88,7 @@ public:
     /** The virtual method to copy a solution. Should be used instead of the classical
      * assignment operator to avoid problems when referring to solutions via a base class. */
     virtual void copy(const mh_solution &s) {
-    	pgroup = s.pgroup; alg = s.alg; length = s.length;
+    	pgroup = s.pgroup; alg = s.alg; length = s.length; ecache = s.ecache;
     	objval = s.objval; objval_valid = s.objval_valid;
     }
 	/** Creates an uninitialized object of the same class as the
@@ -117,15 +138,31 @@ public:
 	virtual ~mh_solution() {}
 	/** Function for getting the objective value.
 		The actual objective function is only called on demand, 
-		if the value is not yet known. The result must be 
-		written into objval. Needs usually not to be overloaded. */
+		if the value is not yet known and, in case an evaluation cache
+		is attached, an equal solution has not been evaluated before.
+		The result must be written into objval. Needs usually not to be overloaded. */
 	virtual double obj() {
 		if (objval_valid)
 			return objval;
+		else if (ecache)
+			return cachedObj();
 		else {
 		  	objval=objective();	objval_valid=true; return objval;
 		}
 	}
+	/** Function for getting the objective value or just the information
+		that it is worse than a given bound.
+		If the objective value is not yet known, boundedObjective() is called
+		for determining it. The returned value is exact if it is not worse than
+		bound; otherwise, it only indicates that the objective value is worse than
+		bound and the solution remains unevaluated. If an evaluation cache is
+		attached, the exact value is always determined. */
+	double obj(double bound);
+	/** Sets the objective value to an externally determined value.
+		Useful e.g. after applying a move for which the change in
+		the objective value is known, see gaopsProvider::delta_obj(). */
+	void setObj(double o)
+		{ objval=o; objval_valid=true; }
 	/** Writes the solution to an ostream.
 		The solution is written to the given ostream in	text format.
 		@param ostr the output stream
@@ -153,6 +190,19 @@ public:
 	bool isWorse(mh_solution &p)
 		{ return maxi(pgroup)?obj()<p.obj():
 			obj()>p.obj(); }
+	/** Returns true if the current solution is better in terms of the
+		objective function than the given objective value.
+		As the evaluation is done via obj(double), it may be terminated
+		early when the solution is not yet evaluated and turns out to be
+		not better. Takes care on parameter mh::maxi. */
+	bool isBetter(double o)
+		{ return maxi(pgroup)?obj(o)>o:obj(o)<o; }
+	/** Returns true if the current solution is worse in terms of the
+		objective function than the given objective value.
+		As the evaluation is done via obj(double), it may be terminated
+		early when the solution turns out to be worse. Takes care on parameter mh::maxi. */
+	bool isWorse(double o)
+		{ return maxi(pgroup)?obj(o)<o:obj(o)>o; }
 	/** Invalidates the solution.
 		Sets objval to be invalid. During the next call to obj(), the
 		solution is evaluated anew. Must be called when the
@@ -26,6 +26,14 @@ probability, but at least one mutation is applied, so that no chromosome
 is simply copied. */
 extern double_param pmutnc;
 
+/** \ingroup param
+Conditional replacement. If this parameter is set, a new solution is
+only inserted into the population if it is not worse than the currently
+worst solution; otherwise it is discarded. As the new solution is only
+evaluated until this becomes clear, see mh_solution::boundedObjective(),
+this may save considerable evaluation time. */
+extern bool_param rcond;
+
 /** A Steady-State EA.
 	During each generation, only one new solution is generated by means
 	of variation operators (crossover and mutation). The new solution
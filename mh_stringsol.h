@@ -100,6 +100,9 @@ public:
 	void mutate(int count) override;
 	/** Calls a crossover method, controlled by the parameter strxop(). */
 	void crossover(const mh_solution &parA,const mh_solution &parB) override;
+	/** Path relinking step: sets a randomly chosen gene that differs
+		from the guiding solution to the guide's value. */
+	bool pathRelinkStep(const mh_solution &guide) override;
 	void write(std::ostream &ostr,int detailed=0) override;
 	/** Saves the solution to the given file if fname!="NULL". */
 	void save(const std::string &fname) override;
@@ -144,11 +147,12 @@ template <class T> void stringSol<T>::copy(const mh_solution &orig)
 
 template <class T> bool stringSol<T>::equals(mh_solution &orig)
 {
-	// to be efficient: check first objective values
-	if (orig.obj()!=obj())
+	// to be efficient: check first objective values if they are known,
+	// but do not enforce an evaluation
+	const stringSol<T> &sc=cast(orig);
+	if (objval_valid && sc.objval_valid && sc.objval!=objval)
 		return false;
 	// and now all the genes
-	const stringSol<T> &sc=cast(orig);
 	for (int i=0;i<length;i++)
 		if (data[i]!=sc.data[i])
 			return false;
@@ -165,6 +169,21 @@ template <class T> double stringSol<T>::dist(mh_solution &c)
 	return diffs;
 }
 
+template <class T> bool stringSol<T>::pathRelinkStep(const mh_solution &guide)
+{
+	const stringSol<T> &g=cast(guide);
+	std::vector<int> diff;
+	for (int i=0;i<length;i++)
+		if (data[i]!=g.data[i])
+			diff.push_back(i);
+	if (diff.empty())
+		return false;
+	int i=diff[random_int(diff.size())];
+	data[i]=g.data[i];
+	invalidate();
+	return true;
+}
+
 template <class T> void stringSol<T>::initialize(int count)
 {
 	for (int i=0;i<length;i++)
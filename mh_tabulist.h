@@ -6,6 +6,7 @@
 
 #include <unordered_map>
 #include <queue>
+#include <vector>
 #include "mh_param.h"
 #include "mh_tabuattribute.h"
 
@@ -60,16 +61,77 @@ public:
 	/** Default constructor.
 	        Size of tabulist is determined through parameters. */      
 	explicit tabulist( const std::string &pg="") : size(tlsize(pg)), pgroup(pg) {}
-	/** The destructor. */
-	virtual ~tabulist() {}
-	/** Removes all entries in the hash-table. */
-	virtual void clear() { tlist.empty(); tqueue.empty(); };
+	/** The destructor deletes the stored tabuAttributes. */
+	virtual ~tabulist() { clear(); }
+	/** Removes and deletes all entries. */
+	virtual void clear();
 	/** Adds one new tabuAttribute to the tabulist. */
 	virtual void add( tabuAttribute *t );
 	/** Checks if a given tabuAttribute is already known. */
 	virtual bool match( const tabuAttribute *t );
 };
 
+/** A value-typed tabu memory for attributes given by pairs of indices.
+	Typical attributes are (element, position) pairs or (i,j) swaps.
+	In contrast to tabulist, no tabuAttribute objects are allocated:
+	For each attribute, a matrix of size n1 x n2 stores the iteration
+	until which the attribute is tabu. An internal clock is advanced
+	by nextIteration(), and an attribute is tabu as long as its stamp
+	lies in the future. Checks and insertions therefore take constant
+	time, and clear() takes constant time by advancing the clock beyond
+	all stored stamps. */
+class tabuMemory
+{
+protected:
+	int n1;		///< Number of values for the first index.
+	int n2;		///< Number of values for the second index.
+	/// Iteration until which an attribute (i,j) is tabu, stored at i*n2+j.
+	std::vector<unsigned long int> until;
+	unsigned long int clock = 1;	///< The current iteration.
+	unsigned long int maxTenure = 0;	///< Largest tenure used so far.
+	int deftenure;		///< Default tenure, see #tlsize.
+
+public:
+	/** Constructor for attributes (i,j) with 0<=i<n1 and 0<=j<n2.
+		The default tenure is taken from parameter #tlsize. */
+	tabuMemory(int _n1, int _n2, const std::string &pg="") :
+		n1(_n1), n2(_n2), until(size_t(_n1)*_n2,0), deftenure(tlsize(pg)) {}
+	/** Constructor for single index attributes 0<=i<n, i.e., with n2=1. */
+	explicit tabuMemory(int n, const std::string &pg="") : tabuMemory(n,1,pg) {}
+	/** Returns the number of values of the first index. */
+	int size1() const { return n1; }
+	/** Returns the number of values of the second index. */
+	int size2() const { return n2; }
+	/** Returns the default tenure. */
+	int tenure() const { return deftenure; }
+	/** Returns the current iteration of the internal clock. */
+	unsigned long int iteration() const { return clock; }
+	/** Advances the internal clock by one iteration, so that all
+		tenures are decremented by one. */
+	void nextIteration() { clock++; }
+	/** Makes attribute (i,j) tabu for the given number of iterations. */
+	void add(int i, int j, int tenure)
+		{
+			until[size_t(i)*n2+j] = clock+tenure;
+			if ((unsigned long int)tenure > maxTenure)
+				maxTenure = tenure;
+		}
+	/** Makes attribute (i,j) tabu for the default number of iterations. */
+	void add(int i, int j) { add(i,j,deftenure); }
+	/** Makes single index attribute i tabu for the default number of iterations. */
+	void add(int i) { add(i,0,deftenure); }
+	/** Checks whether attribute (i,j) is currently tabu. */
+	bool isTabu(int i, int j) const
+		{ return until[size_t(i)*n2+j] > clock; }
+	/** Checks whether single index attribute i is currently tabu. */
+	bool isTabu(int i) const { return isTabu(i,0); }
+	/** Returns the number of remaining iterations attribute (i,j) is tabu. */
+	int remaining(int i, int j) const
+		{ return isTabu(i,j) ? int(until[size_t(i)*n2+j]-clock) : 0; }
+	/** Makes all attributes non-tabu in constant time. */
+	void clear() { clock += maxTenure+1; maxTenure=0; }
+};
+
 } // end of namespace mh
 
 #endif //MH_TABULIST_H
@@ -8,14 +8,40 @@
 
 #include "mh_interfaces.h"
 #include "mh_lsbase.h"
+#include "mh_nhscan.h"
 #include "mh_tabulist.h"
 
 namespace mh {
 
+/** \ingroup param
+    Use the move evaluation engine of tabu search for solutions that are
+    moveEvalProviders instead of their selectNeighbour(). */
+extern bool_param tsmove;
+
+/** \ingroup param
+    Number of moves evaluated by a single call of
+    moveEvalProvider::evalMoves() in tabu search. */
+extern int_param tsbatch;
+
+/** \ingroup param
+    Relative range for randomizing the tabu tenure in tabu search
+    (robust tabu search). If >0, the tenure of each move is chosen
+    uniformly at random from [tlsize*(1-tlrand), tlsize*(1+tlrand)],
+    but is at least one. Only used if #tsmove is set. */
+extern double_param tlrand;
+
 /** Tabu search.
 	During each iteration the best neighbour of the current solution
 	is searched with respect to its tabustate and an aspieration
-	criterion. */
+	criterion.
+	If the solution class is a moveEvalProvider and #tsmove is set, the search is done by
+	the algorithm itself: the whole neighborhood is evaluated in batches
+	of #tsbatch moves by #nhthreads threads, and the best move that is not tabu w.r.t. a
+	tabuMemory or leads to a new best solution (aspiration) is applied.
+	If all moves are tabu, the best tabu move is applied. The tenure
+	of the attributes of applied moves is #tlsize, randomized by #tlrand.
+	Otherwise, selectNeighbour() of the solution is called, which
+	is then responsible for considering the tabu list tl_ne. */
 class tabuSearch : public lsbase, public tabulistProvider
 {
 protected:
@@ -23,6 +49,20 @@ protected:
 	        This must not necessarily be the best known solution so
 		far, therefore it is not in the population. */
 	mh_solution *curChrom = nullptr;
+
+	/** The tabu memory used for moveEvalProviders. */
+	tabuMemory *tm = nullptr;
+
+	/** Scanner for evaluating the neighborhood, possibly in parallel. */
+	nhScanner *scanner = nullptr;
+
+	int _tlsize;		///< Mirrored mhlib parameter #tlsize.
+	double _tlrand;		///< Mirrored mhlib parameter #tlrand.
+
+	/** Performs an iteration with the moveEvalProvider interface. */
+	virtual void performMoveIteration(moveEvalProvider &mep);
+	/** Returns the tenure for the next move. */
+	virtual int tenure();
 	
 public:
 	/** A tabulist containing tabuattributes which are tabu. */
@@ -35,7 +75,7 @@ public:
 	tabuSearch(pop_base &p, const std::string &pg="");
 	/** Another constructor.
 		Creates an empty Algorithm that can only be used as a template. */
-	tabuSearch(const std::string &pg="") : lsbase(pg) {}
+	tabuSearch(const std::string &pg="") : lsbase(pg), _tlsize(0), _tlrand(0) {}
 	/** The destructor. */
 	~tabuSearch();
 	/** Create new simulatedAnnealing.
@@ -46,7 +86,8 @@ public:
 		Is called from run() */
 	virtual void performIteration();
 	/** Checks if a tabu is currently tabu.
-	        Is called from chromsome::neighbour() */
+	        Is called from chromsome::neighbour().
+	        Tabus are counted in the statistics. */
 	virtual bool isTabu(tabuAttribute *t);
 	/** Checks if a chromsome can overide its tabustate. */
 	virtual bool aspiration(mh_solution *c);
@@ -0,0 +1,124 @@
+/*! \file mh_threadpool.h
+	\brief Process-wide work-stealing thread pool.
+
+	All parallel algorithms of mhlib draw their threads from a single
+	threadPool, so that nesting, e.g., a Scheduler used within a method of
+	another one, does not create threads again and again. Short tasks, such
+	as the parts of a parallel_for(), are distributed by work stealing and
+	only use threads that are idle; tasks that may block, such as the
+	workers of a ParScheduler, are started by startConcurrent(). */
+
+#ifndef MH_THREADPOOL_H
+#define MH_THREADPOOL_H
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "mh_c11threads.h"
+#include "mh_param.h"
+
+namespace mh {
+
+/** \ingroup param
+	Number of threads of the process-wide thread pool used for parallel
+	loops, including the calling thread; 0 means the number of hardware
+	threads. Tasks that may block are started in additional threads if
+	needed. */
+extern int_param poolthreads;
+
+/** Group of tasks started by threadPool::startConcurrent() that can be
+	waited for. */
+class taskGroup
+{
+public:
+	/** Blocks until all tasks of the group have finished and rethrows
+		the first exception that occurred in one of them. */
+	void wait();
+
+protected:
+	friend class threadPool;
+	std::mutex mutex;			///< Protects the data of the group.
+	std::condition_variable cv;	///< Signals finished tasks.
+	int pending = 0;			///< Number of tasks not finished yet.
+	std::exception_ptr exception;	///< First exception that occurred.
+};
+
+/** Work-stealing thread pool.
+	Each pool thread has its own deque of tasks, where tasks submitted by
+	the thread itself are put and taken from the back, while idle threads
+	steal from the front of other threads' deques. Tasks submitted by other
+	threads are put into a common queue. The thread random number generator
+	is reset after each task. */
+class threadPool
+{
+public:
+	/** Creates a pool for the given number of threads including the
+		calling thread; the threads are started when first needed. */
+	explicit threadPool(int nthreads);
+	/** The destructor waits for all tasks and terminates the threads. */
+	~threadPool();
+	/** Returns the process-wide pool with #poolthreads threads. */
+	static threadPool &global();
+	/** Returns the number of threads including the calling one, i.e.,
+		the number of tasks that may be executed in parallel. */
+	int size() const
+		{ return nThreads; }
+
+	/** Submits a task that is executed by some pool thread.
+		The task must not block, e.g., wait for other tasks. */
+	void submit(std::function<void()> task);
+	/** Starts a task that may block, e.g., by waiting for other tasks
+		started this way, in an idle pool thread or, if there is none, in an
+		additional thread, which then stays in the pool. The task is added
+		to the given group for waiting for its completion. */
+	void startConcurrent(taskGroup &group, std::function<void()> task);
+
+	/** Calls f(0) in the calling thread and f(1),...,f(k) in at most
+		nhelpers idle pool threads, with k being the number of helpers that
+		started before f(0) returned; others are skipped. f must distribute
+		the work among the calls dynamically, e.g., by an atomic counter.
+		Returns after all calls have finished, rethrowing the first exception. */
+	void run(int nhelpers, const std::function<void(int)> &f);
+
+	/** Calls f(lo,hi) for consecutive ranges partitioning [begin,end),
+		each consisting of grain elements except the last, in parallel. */
+	void parallel_for(int begin, int end, int grain,
+		const std::function<void(int lo, int hi)> &f);
+
+protected:
+	/** The data of a pool thread. */
+	struct worker
+	{
+		std::thread thread;			///< The thread.
+		std::deque<std::function<void()> > tasks;	///< Own tasks.
+		std::mutex mutex;			///< Protects tasks.
+	};
+
+	int nThreads;		///< Number of threads including the calling thread.
+	std::vector<std::unique_ptr<worker> > workers;	///< The pool threads.
+	std::deque<std::function<void()> > common;		///< Tasks submitted from outside.
+	std::deque<std::function<void()> > blocking;	///< Tasks started by startConcurrent().
+	std::mutex mutex;		///< Protects workers, common, blocking, and terminating.
+	std::condition_variable cv;	///< Signals new tasks to idle threads.
+	std::atomic<int> nPending;	///< Number of submitted tasks not taken yet.
+	std::atomic<int> nIdle;		///< Number of threads waiting for tasks.
+	bool terminating = false;	///< Set when the threads have to terminate.
+
+	/** Starts a new pool thread; mutex must be held. */
+	void addWorker();
+	/** Main loop of pool thread w. */
+	void workerLoop(worker *w);
+	/** Takes a task for the given pool thread, or nullptr for another thread,
+		from its own deque, the common queue, or another thread's deque.
+		Returns false if there is none. */
+	bool takeTask(worker *w, std::function<void()> &task);
+	/** Executes a task, resetting the random number generator afterwards. */
+	static void execute(std::function<void()> &task);
+};
+
+} // end of namespace mh
+
+#endif // MH_THREADPOOL_H
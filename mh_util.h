@@ -6,8 +6,10 @@
 #ifndef MH_UTIL_H
 #define MH_UTIL_H
 
+#include <atomic>
 #include <string>
 #include <exception>
+#include <vector>
 #include "mh_param.h"
 
 /** The mhlib has this single namespace containing all its components.
@@ -46,11 +48,61 @@ double mhcputime();
 /** Return the wall clock time in seconds since the process was started. */
 double mhwctime();
 
+/** Return the CPU time in seconds used by the calling thread.
+ * In contrast to mhcputime(), which sums up the CPU times of all threads, this
+ * is the appropriate measure for the time of a method performed in a thread.
+ * Falls back to mhcputime() if no thread CPU clock is available. */
+double mhthreadcputime();
+
 /** Return either the CPU time or the wall clock time in seconds since the process was started, depending on parameter wctim. */
 inline double mhtime(bool wctim=false) {
 	return wctim ? mhwctime() : mhcputime();
 }
 
+/** Amortized check whether a time limit has been reached, for termination
+ * criteria that are checked very frequently, e.g., in each iteration.
+ * Reading a CPU time clock is a system call, whereas the wall clock mhwctime() is
+ * cheap. Each call therefore reads the wall clock, and the CPU time clock is only read
+ * when at least #interval seconds of wall clock time have passed since its last
+ * reading; a CPU time limit is thus recognized at most about #interval seconds of wall
+ * clock time late, independently of how expensive the calls are. A wall clock time
+ * limit is checked exactly. May be called concurrently from multiple threads. */
+class timeLimitChecker {
+public:
+	/** Constructor for the given interval in seconds between reading the CPU time clock. */
+	explicit timeLimitChecker(double interval=0.001) : interval(interval) {
+		reset();
+	}
+	/** The copy constructor only copies the interval. */
+	timeLimitChecker(const timeLimitChecker &c) : timeLimitChecker(c.interval) {}
+	/** Returns true if the time given by mhtime(wctim) is at least limit,
+	 * where the CPU time clock is only read when due and false is returned otherwise. */
+	bool reached(double limit, bool wctim=false);
+	/** Resets the checker, so that the clock is read at the next call. */
+	void reset() {
+		nextRead = -1;
+	}
+protected:
+	const double interval;		///< Wall clock time between reading the CPU time clock.
+	std::atomic<double> nextRead;	///< Wall clock time from which on the CPU time clock is read.
+};
+
+/** Returns the logical CPUs the calling thread may run on, or an empty vector if
+ * thread affinities are not supported on this platform. */
+std::vector<int> threadAffinity();
+
+/** Restricts the calling thread to the given logical CPUs, e.g., for pinning it
+ * to a single one. Returns false if not supported or not successful. */
+bool setThreadAffinity(const std::vector<int> &cpus);
+
+/** Returns the logical CPUs the calling thread may run on in the order in which
+ * threads should be pinned to them. In compact order, hardware threads of the same
+ * core and cores of the same processor package are adjacent, so that threads
+ * share caches; in scatter order, consecutive CPUs are on different packages and
+ * cores as far as possible, so that threads spread over all NUMA nodes and memory
+ * channels. Returns an empty vector if affinities are not supported. */
+std::vector<int> cpuPlacementOrder(bool scatter);
+
 /** Convert a basic type, e.g., int, into a string. Implemented here as
  * std::to_string is not yet implemented in certain C++ libraries.
  */